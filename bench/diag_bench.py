@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+#
+#  @copyright S. Levent Yilmaz 2016
+#  Distributed under the Boost Software License, Version 1.0.
+#  See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt.
+#
+"""Diagnostic size and time of a failing STATIC_EXPECT_THAT on an expression-template type.
+
+The argument is a balanced binary tree of `expr<Op, L, R>` nodes, --depth levels deep, the shape
+expression-template libraries produce. A translation unit with one failing and one with one
+passing assertion are compiled with the reduced-diagnostic mode off and on
+(ST_STATIC_EXPECT_CONFIG_TYPE_SUMMARY). Reported are the bytes of compiler output and the
+best-of --repeat compile time.
+"""
+
+import argparse
+import os
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'tools'))
+from compile_cost import run_measured  # noqa: E402
+
+SOURCE = '''\
+#include <static_test/static_expect.hpp>
+
+struct plus; struct times;
+template<class Op, class L, class R> struct expr {{}};
+template<int N> struct leaf {{}};
+
+template<int N, int I = 0> struct tree {{
+    using type = expr< typename std::conditional<N % 2 == 0, plus, times>::type,
+                       typename tree<N-1, 2*I>::type, typename tree<N-1, 2*I+1>::type >;
+}};
+template<int I> struct tree<0, I> {{ using type = leaf<I>; }};
+
+using big = tree<{depth}>::type;
+STATIC_EXPECT_THAT( big, st::static_matchers::Is<{expected}> );
+'''
+
+
+def main():
+    p = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    p.add_argument('--compiler', default='c++')
+    p.add_argument('--std', default='c++11')
+    p.add_argument('--depth', type=int, action='append', help='tree depths (default: 4, 8, 12)')
+    p.add_argument('--repeat', type=int, default=3)
+    p.add_argument('-I', dest='includes', action='append', default=[])
+    opts = p.parse_args()
+
+    print('%-6s %-5s %-8s %14s %10s' % ('depth', 'case', 'summary', 'stderr bytes', 'ms'))
+    with tempfile.TemporaryDirectory() as tmp:
+        for depth in opts.depth or [4, 8, 12]:
+            for case, expected in (('fail', 'int'), ('pass', 'big')):
+                src = os.path.join(tmp, 'diag_%d_%s.cpp' % (depth, case))
+                with open(src, 'w') as f:
+                    f.write(SOURCE.format(depth=depth, expected=expected))
+                for summary in (0, 1):
+                    cmd = [opts.compiler, '-std=' + opts.std, '-fsyntax-only',
+                           '-DST_STATIC_EXPECT_CONFIG_TYPE_SUMMARY=%d' % summary, src]
+                    cmd += ['-I' + os.path.abspath(i) for i in opts.includes]
+                    best, size = None, None
+                    for _ in range(opts.repeat):
+                        rc, err, ms, _ = run_measured(cmd, tmp)
+                        if (rc != 0) != (case == 'fail'):
+                            sys.stderr.write(err)
+                            raise SystemExit('diag_bench: unexpected compile result: %s' % src)
+                        best = ms if best is None else min(best, ms)
+                        size = len(err.encode())
+                    print('%-6d %-5s %-8s %14d %10.1f'
+                          % (depth, case, 'on' if summary else 'off', size, best))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
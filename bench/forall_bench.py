@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+#
+#  @copyright S. Levent Yilmaz 2016
+#  Distributed under the Boost Software License, Version 1.0.
+#  See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt.
+#
+"""Compile cost of STATIC_FOR_ALL over N x N x N grids of types.
+
+Each grid is checked once with a single STATIC_FOR_ALL, and once with the equivalent N^3
+hand-written STATIC_EXPECT_THAT assertions. Reported are the best-of --repeat compile time
+(-fsyntax-only) and the peak memory of the compiler, and the time per combination, which stays
+flat as the grid grows when the instantiations are linear in its size.
+"""
+
+import argparse
+import os
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'tools'))
+from compile_cost import run_measured  # noqa: E402
+
+PROLOGUE = '''\
+#include <static_test/static_expect.hpp>
+
+template<int N> struct a {{ char c[N+1]; }};
+template<int N> struct b {{ char c[N+1]; }};
+template<int N> struct c {{ char c[N+1]; }};
+
+struct Fits {{
+    template<class A, class B, class C>
+    struct apply : std::integral_constant<bool, (sizeof(A) + sizeof(B) + sizeof(C) < {limit})> {{}};
+}};
+'''
+
+
+def grid(n):
+    lists = ['(%s)' % ', '.join('%s<%d>' % (t, i) for i in range(n)) for t in 'abc']
+    return 'STATIC_FOR_ALL( %s, Fits );\n' % ', '.join(lists)
+
+
+def hand_written(n):
+    return ''.join('STATIC_EXPECT_THAT( a<%d>, b<%d>, c<%d>, Fits );\n' % (i, j, k)
+                   for i in range(n) for j in range(n) for k in range(n))
+
+
+def main():
+    p = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    p.add_argument('--compiler', default='c++')
+    p.add_argument('--std', default='c++11')
+    p.add_argument('--size', type=int, action='append', help='grid sizes N (default: 5, 10, 20)')
+    p.add_argument('--repeat', type=int, default=3)
+    p.add_argument('-I', dest='includes', action='append', default=[])
+    opts = p.parse_args()
+
+    print('%-12s %8s %8s %10s %12s %12s' % ('form', 'grid', 'checks', 'ms', 'us/check', 'peak_rss_kb'))
+    with tempfile.TemporaryDirectory() as tmp:
+        for n in opts.size or [5, 10, 20]:
+            forms = [('for_all', grid(n))]
+            if n <= 10:   # thousands of assertions beyond that: too slow to be worth waiting for
+                forms.append(('hand_written', hand_written(n)))
+            for name, body in forms:
+                src = os.path.join(tmp, '%s_%d.cpp' % (name, n))
+                with open(src, 'w') as f:
+                    f.write(PROLOGUE.format(limit=3 * n + 4) + body)
+                cmd = [opts.compiler, '-std=' + opts.std, '-fsyntax-only', src]
+                cmd += ['-I' + os.path.abspath(i) for i in opts.includes]
+                best, rss = None, None
+                for _ in range(opts.repeat):
+                    rc, err, ms, kb = run_measured(cmd, tmp)
+                    if rc != 0:
+                        sys.stderr.write(err)
+                        raise SystemExit('forall_bench: failed to compile ' + src)
+                    if best is None or ms < best:
+                        best, rss = ms, kb
+                checks = n ** 3
+                print('%-12s %8s %8d %10.1f %12.1f %12d'
+                      % (name, '%dx%dx%d' % (n, n, n), checks, best, best * 1000.0 / checks, rss))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
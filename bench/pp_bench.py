@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+#
+#  @copyright S. Levent Yilmaz 2016
+#  Distributed under the Boost Software License, Version 1.0.
+#  See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt.
+#
+"""Preprocessing-time benchmark of the ST_PP macros on the STATIC_EXPECT_THAT path.
+
+For every macro under test a translation unit with --count invocations is generated and run
+through the preprocessor only (-E), once per language standard and once per ST_PP path (fast /
+portable). Reported is the best-of --repeat time per 1000 invocations.
+"""
+
+import argparse
+import os
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'tools'))
+from compile_cost import run_measured  # noqa: E402
+
+CASES = [
+    ('ST_PP_STRINGIZE', '#include <static_test/pp/misc.hpp>',
+     'char const* s{i} = ST_PP_STRINGIZE(std::pair<int, double>, long, char{i});'),
+    ('ST_PP_VARIADIC_SIZE', '#include <static_test/pp/variadic.hpp>',
+     'int n{i}[ST_PP_VARIADIC_SIZE(a, b, c, d{i})];'),
+    ('ST_PP_REMOVE_PAREN', '#include <static_test/pp/remove_paren.hpp>',
+     'using t{i} = ST_PP_REMOVE_PAREN((std::map<int, long{i}>));'),
+    ('STATIC_EXPECT_THAT', '#include <static_test/static_expect.hpp>',
+     'STATIC_EXPECT_THAT((std::pair<int, long{i}>), (Is<std::pair<int, long{i}>>));'),
+]
+
+
+def main():
+    p = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    p.add_argument('--compiler', default='c++')
+    p.add_argument('--std', action='append', help='language standards (default: c++11, c++20)')
+    p.add_argument('--count', type=int, default=1000, help='invocations per TU')
+    p.add_argument('--repeat', type=int, default=3)
+    p.add_argument('-I', dest='includes', action='append', default=[])
+    opts = p.parse_args()
+    stds = opts.std or ['c++11', 'c++20']
+
+    print('%-22s %-8s %14s %14s %8s' % ('macro', 'std', 'portable ms/k', 'fast ms/k', 'speedup'))
+    with tempfile.TemporaryDirectory() as tmp:
+        for name, include, line in CASES:
+            src = os.path.join(tmp, name + '.cpp')
+            with open(src, 'w') as f:
+                f.write(include + '\n')
+                for i in range(opts.count):
+                    f.write(line.format(i=i) + '\n')
+            for std in stds:
+                ms = []
+                for fast in (0, 1):
+                    cmd = [opts.compiler, '-std=' + std, '-E', '-P', '-o', os.devnull,
+                           '-DST_PP_CONFIG_FAST_PATH=%d' % fast, src]
+                    cmd += ['-I' + os.path.abspath(i) for i in opts.includes]
+                    best = None
+                    for _ in range(opts.repeat):
+                        rc, err, t, _ = run_measured(cmd, tmp)
+                        if rc != 0:
+                            sys.stderr.write(err)
+                            raise SystemExit('pp_bench: preprocessing failed: ' + name)
+                        best = t if best is None else min(best, t)
+                    ms.append(best * 1000.0 / opts.count)
+                print('%-22s %-8s %14.2f %14.2f %7.2fx' % (name, std, ms[0], ms[1], ms[0] / ms[1]))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
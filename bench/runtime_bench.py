@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+#
+#  @copyright S. Levent Yilmaz 2016
+#  Distributed under the Boost Software License, Version 1.0.
+#  See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt.
+#
+"""Checks per second of RUNTIME_EXPECT_THAT, passing and failing.
+
+A program with --sites distinct checks, over distinct types, runs them until --checks checks are
+done, and reports the rate and the heap allocations per check (operator new is counted). The
+`naive` rows do what a straightforward runtime reporter would: build the message in a std::string
+with the demangled typeid names, for every check. Failures go to a sink that drops them.
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+
+SOURCE = '''\
+#include <static_test/runtime_expect.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cxxabi.h>
+#include <new>
+#include <string>
+#include <typeinfo>
+
+using namespace st::static_matchers;
+
+static unsigned long long allocations = 0;
+void* operator new( std::size_t n ) {{ ++allocations; if (void* p = std::malloc(n)) return p; throw std::bad_alloc(); }}
+void operator delete( void* p ) noexcept {{ std::free(p); }}
+
+template<int N> struct v {{}};
+
+static void drop( st::runtime::failure const& ) {{}}
+
+static std::string demangled( char const* name ) {{
+    int status = 0;
+    char* s = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+    std::string r = s ? s : name;
+    std::free(s);
+    return r;
+}}
+
+template<class T, class Expected>
+static __attribute__((noinline)) bool naive( char const* file, int line ) {{
+    std::string msg = std::string(file) + ":" + std::to_string(line) + ": Is<" +
+                      demangled(typeid(Expected).name()) + "> with " + demangled(typeid(T).name());
+    bool ok = std::is_same<T, Expected>::value;
+    if (!ok)
+        drop(st::runtime::failure());
+    return ok && !msg.empty();
+}}
+
+static __attribute__((noinline)) unsigned runtimePass() {{
+    unsigned ok = 0;
+{runtime_pass}
+    return ok;
+}}
+static __attribute__((noinline)) unsigned runtimeFail() {{
+    unsigned ok = 0;
+{runtime_fail}
+    return ok;
+}}
+static __attribute__((noinline)) unsigned naivePass() {{
+    unsigned ok = 0;
+{naive_pass}
+    return ok;
+}}
+static __attribute__((noinline)) unsigned naiveFail() {{
+    unsigned ok = 0;
+{naive_fail}
+    return ok;
+}}
+
+template<class F>
+static void measure( char const* form, char const* result, F f ) {{
+    unsigned long long rounds = {checks} / {sites};
+    static volatile unsigned long long sink = 0;
+    unsigned long long before = allocations;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long long i = 0; i != rounds; ++i)
+        sink += f();
+    double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double checks = double(rounds * {sites});
+    std::printf("%-8s %-5s %10.0f %14.0f %12.2f\\n", form, result, checks, checks / s,
+                double(allocations - before) / checks);
+}}
+
+int main() {{
+    st::runtime::setFailureSink(&drop);
+    std::printf("%-8s %-5s %10s %14s %12s\\n", "form", "case", "checks", "checks/s", "allocs/check");
+    measure("runtime", "pass", runtimePass);
+    measure("runtime", "fail", runtimeFail);
+    measure("naive",   "pass", naivePass);
+    measure("naive",   "fail", naiveFail);
+}}
+'''
+
+
+def main():
+    p = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    p.add_argument('--compiler', default='c++')
+    p.add_argument('--std', default='c++11')
+    p.add_argument('--sites', type=int, default=100, help='distinct checks in the program')
+    p.add_argument('--checks', type=int, default=100000, help='checks per measurement')
+    p.add_argument('-I', dest='includes', action='append', default=[])
+    opts = p.parse_args()
+
+    def sites(fmt):
+        return '\n'.join('    ok += ' + fmt.format(i=i, j=i + 1) + ';' for i in range(opts.sites))
+
+    source = SOURCE.format(
+        sites=opts.sites, checks=opts.checks,
+        runtime_pass=sites('RUNTIME_EXPECT_THAT( v<{i}>, Is<v<{i}>> )'),
+        runtime_fail=sites('RUNTIME_EXPECT_THAT( v<{i}>, Is<v<{j}>> )'),
+        naive_pass=sites('naive<v<{i}>, v<{i}>>(__FILE__, __LINE__)'),
+        naive_fail=sites('naive<v<{i}>, v<{j}>>(__FILE__, __LINE__)'))
+
+    with tempfile.TemporaryDirectory() as tmp:
+        src = os.path.join(tmp, 'runtime_bench.cpp')
+        exe = os.path.join(tmp, 'runtime_bench')
+        with open(src, 'w') as f:
+            f.write(source)
+        cmd = [opts.compiler, '-std=' + opts.std, '-O2', src, '-o', exe]
+        cmd += ['-I' + os.path.abspath(i) for i in opts.includes]
+        subprocess.check_call(cmd)
+        return subprocess.call([exe])
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -6,7 +6,27 @@
 
 #pragma once
 
-#include <boost/config.hpp>
+//     +------------+
+//     |  Compiler  |
+//     +------------+
+
+// MSVC proper (not clang-cl) and GCC proper (not Clang, nor the others that define __GNUC__), with
+// their versions as Boost.Config gives them, so that the library doesn't need Boost beyond
+// Boost.Preprocessor.
+#if defined(_MSC_VER) && !defined(__clang__)
+#  define ST_CONFIG_MSVC _MSC_VER
+#endif
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__INTEL_COMPILER)
+#  define ST_CONFIG_GCC (__GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__)
+#endif
+
+#if defined(_MSC_VER)
+#  define ST_CONFIG_NOINLINE __declspec(noinline)
+#elif defined(__GNUC__)
+#  define ST_CONFIG_NOINLINE __attribute__((noinline))
+#else
+#  define ST_CONFIG_NOINLINE
+#endif
 
 //     +------------------------+
 //     |  Installation Options  |
@@ -31,7 +51,7 @@
 
 #ifndef ST_STATIC_EXPECT_CONFIG_USE_NEWLINES_IN_MESSAGE
 #  // VS converts \n in static_assert messages into actual new-lines in compiler output:
-#  ifdef BOOST_MSVC
+#  ifdef ST_CONFIG_MSVC
 #    define ST_STATIC_EXPECT_CONFIG_USE_NEWLINES_IN_MESSAGE
 #  endif
 #endif
@@ -42,12 +62,30 @@
 #   define ST_STATIC_EXPECT_CONFIG_TYPEDISPLAY_PREFIX  Type
 #endif
 
+// Suffix that makes the names declared by STATIC_EXPECT_DEFERRED and ST_COVERAGE_POINT unique in
+// their scope. The line keeps a class template or inline function in a header the same sequence of
+// tokens in every translation unit, which __COUNTER__ would not (an ODR violation).
+#ifndef ST_STATIC_EXPECT_CONFIG_UNIQUE_ID
+#  define ST_STATIC_EXPECT_CONFIG_UNIQUE_ID __LINE__
+#endif
+
 // Generate a static_assert upon failure (set to 0 if not needed; you can choose to keep the
 // forged-error instead)
 #ifndef ST_STATIC_EXPECT_CONFIG_STATIC_ASSERT
 #  define ST_STATIC_EXPECT_CONFIG_STATIC_ASSERT 1
 #endif
 
+// Embed a machine readable record of the failing assertion at the front of its static_assert
+// message, for CI log parsing:
+//
+//     [st-failure`<file>`<line>`<matcher>`0:<argument 0>`1:<argument 1>`...`]
+//
+// Fields are separated by backticks, a character that C++ code can't contain outside of literals.
+// tools/st_log2json.py turns the records found in GCC, Clang or MSVC output into JSON.
+#ifndef ST_STATIC_EXPECT_CONFIG_STRUCTURED_MESSAGE
+#  define ST_STATIC_EXPECT_CONFIG_STRUCTURED_MESSAGE 0
+#endif
+
 // Upon test failure, "forge" (fake out) a compiler error which would show the type argument as part
 // of the resolved expression.
 #ifndef ST_STATIC_EXPECT_CONFIG_FORGED_ERROR
@@ -59,3 +97,110 @@
 #   define ST_STATIC_EXPECT_CONFIG_FORGED_ERROR_SENTINEL Show_Me_The_Type
 #endif
 
+// Reduced diagnostics: the forged error shows a summary of the type instead of the type in full.
+// Class templates nested deeper than DEPTH have their arguments elided, and only the first WIDTH
+// arguments of each are shown, e.g. with depth 1 and width 2:
+//
+//     std::tuple<std::pair<int, long>, char, float>
+//       -> st::detail::tpl_<std::tuple, st::detail::tpl_<std::pair, st::detail::more_<2>>,
+//                           char, st::detail::more_<1>>
+//
+// Templates with non-type parameters are shown as is. Worth turning on when failing assertions
+// take on expression templates, whose full names can run to megabytes of compiler output.
+#ifndef ST_STATIC_EXPECT_CONFIG_TYPE_SUMMARY
+#  define ST_STATIC_EXPECT_CONFIG_TYPE_SUMMARY 0
+#endif
+#ifndef ST_STATIC_EXPECT_CONFIG_TYPE_SUMMARY_DEPTH
+#  define ST_STATIC_EXPECT_CONFIG_TYPE_SUMMARY_DEPTH 3
+#endif
+#ifndef ST_STATIC_EXPECT_CONFIG_TYPE_SUMMARY_WIDTH
+#  define ST_STATIC_EXPECT_CONFIG_TYPE_SUMMARY_WIDTH 4
+#endif
+
+
+// Coverage mode: ST_COVERAGE_POINT markers (static_test/coverage.hpp) leave a record in the object
+// file for every specialization they are instantiated in, for tools/st_coverage.py to report which
+// of the marked specializations were exercised. Off, the markers expand to nothing.
+#ifndef ST_STATIC_EXPECT_CONFIG_COVERAGE
+#  define ST_STATIC_EXPECT_CONFIG_COVERAGE 0
+#endif
+
+// Per-thread buffer the failure reports of RUNTIME_EXPECT_THAT* are formatted into; longer reports
+// are truncated.
+#ifndef ST_STATIC_EXPECT_CONFIG_RUNTIME_ARENA_SIZE
+#  define ST_STATIC_EXPECT_CONFIG_RUNTIME_ARENA_SIZE 4096
+#endif
+
+// Size of a cache line, for the FitsInCacheLine layout matcher. C++17 has
+// std::hardware_destructive_interference_size for this, but compilers warn that its value varies
+// with tuning flags, which is no good for a layout that is meant to be locked in.
+#ifndef ST_STATIC_EXPECT_CONFIG_CACHE_LINE_SIZE
+#  define ST_STATIC_EXPECT_CONFIG_CACHE_LINE_SIZE 64
+#endif
+
+//     +---------------------+
+//     |  Language Features  |
+//     +---------------------+
+
+// C++17 `template<auto V>` non-type template parameters. Enables value matchers deduced on the
+// type of their argument, and the value mode of STATIC_EXPECT_THAT_VALUE.
+#ifndef ST_CONFIG_HAS_AUTO_NTTP
+#  if defined(__cpp_nontype_template_parameter_auto) && (__cpp_nontype_template_parameter_auto >= 201606L)
+#    define ST_CONFIG_HAS_AUTO_NTTP 1
+#  else
+#    define ST_CONFIG_HAS_AUTO_NTTP 0
+#  endif
+#endif
+
+// C++20 class-type (structural) non-type template parameters
+#ifndef ST_CONFIG_HAS_CLASS_NTTP
+#  if ST_CONFIG_HAS_AUTO_NTTP && defined(__cpp_nontype_template_args) && (__cpp_nontype_template_args >= 201911L)
+#    define ST_CONFIG_HAS_CLASS_NTTP 1
+#  else
+#    define ST_CONFIG_HAS_CLASS_NTTP 0
+#  endif
+#endif
+
+// C++14 relaxed constexpr: loops and local variables in constant evaluation. The string matchers
+// scan with loops then, which compilers evaluate several times faster than recursive calls.
+#ifndef ST_CONFIG_HAS_RELAXED_CONSTEXPR
+#  if defined(__cpp_constexpr) && (__cpp_constexpr >= 201304L)
+#    define ST_CONFIG_HAS_RELAXED_CONSTEXPR 1
+#  else
+#    define ST_CONFIG_HAS_RELAXED_CONSTEXPR 0
+#  endif
+#endif
+
+// C++17 exception specifications as part of the function type. Lets IsNoexcept tell from a
+// pointer to member function alone whether the member is noexcept.
+#ifndef ST_CONFIG_HAS_NOEXCEPT_FUNCTION_TYPE
+#  if defined(__cpp_noexcept_function_type) && (__cpp_noexcept_function_type >= 201510L)
+#    define ST_CONFIG_HAS_NOEXCEPT_FUNCTION_TYPE 1
+#  else
+#    define ST_CONFIG_HAS_NOEXCEPT_FUNCTION_TYPE 0
+#  endif
+#endif
+
+// std::has_unique_object_representations, or the compiler intrinsic behind it, which GCC 7, Clang 6
+// and MSVC 2017 have in any language mode. Enables the NoPadding layout matcher.
+#ifndef ST_CONFIG_HAS_UNIQUE_OBJECT_REPRESENTATIONS
+#  if (defined(ST_CONFIG_GCC) && ST_CONFIG_GCC >= 70000) || (defined(ST_CONFIG_MSVC) && ST_CONFIG_MSVC >= 1911)
+#    define ST_CONFIG_HAS_UNIQUE_OBJECT_REPRESENTATIONS 1
+#  elif defined(__has_builtin)
+#    if __has_builtin(__has_unique_object_representations)
+#      define ST_CONFIG_HAS_UNIQUE_OBJECT_REPRESENTATIONS 1
+#    endif
+#  endif
+#  ifndef ST_CONFIG_HAS_UNIQUE_OBJECT_REPRESENTATIONS
+#    define ST_CONFIG_HAS_UNIQUE_OBJECT_REPRESENTATIONS 0
+#  endif
+#endif
+
+// C++17 std::string_view, which the runtime type names and messages convert to
+#ifndef ST_CONFIG_HAS_STRING_VIEW
+#  if (__cplusplus >= 201703L) || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#    define ST_CONFIG_HAS_STRING_VIEW 1
+#  else
+#    define ST_CONFIG_HAS_STRING_VIEW 0
+#  endif
+#endif
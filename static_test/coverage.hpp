@@ -0,0 +1,76 @@
+/** 
+  @copyright S. Levent Yilmaz 2016
+  Distributed under the Boost Software License, Version 1.0.
+  See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt.
+*/
+
+#pragma once
+
+#include <static_test/config.hpp>
+#include <static_test/pp/misc.hpp>
+
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/stringize.hpp>
+
+///
+/**
+Coverage of template specializations by the static tests. Mark each specialization of interest, in
+its class body:
+
+@code
+    template<class L> struct mp_size_impl;
+
+    template<template<class...> class L, class... T> struct mp_size_impl<L<T...>> {
+        ST_COVERAGE_POINT( mp_size_impl<L<T...>> );
+        using type = std::integral_constant<std::size_t, sizeof...(T)>;
+    };
+@endcode
+
+With ST_STATIC_EXPECT_CONFIG_COVERAGE=1, every instantiation of a marked specialization leaves a
+record in the object file it is compiled into:
+
+    [st-covered`<file>`<line>`<name>`]
+
+tools/st_coverage.py finds the markers in the sources and the records in the object files, and
+reports which specializations were exercised and which were not. The record is a string literal
+kept by an unused, never called function, so it costs no code and no run time even in coverage
+mode; otherwise the marker is an empty static_assert, and costs nothing at all. This header needs
+only config.hpp and pp/misc.hpp (plus Boost.PP), not static_expect.hpp or the matchers, so that
+production headers can include it cheaply.
+
+The marker is a member declaration: it works in class (template) bodies only, one per line. Its
+names are made unique by ST_STATIC_EXPECT_CONFIG_UNIQUE_ID, the line by default, so that a marked
+class template in a header is the same sequence of tokens in every translation unit. Records are
+kept through `__attribute__((used))`, so coverage mode needs GCC or Clang.
+*/
+#if ST_STATIC_EXPECT_CONFIG_COVERAGE
+
+#define ST_COVERAGE_POINT( ... ) \
+    ST_COVERAGE_POINT_impl_( BOOST_PP_CAT(ST_CoveragePoint_, ST_STATIC_EXPECT_CONFIG_UNIQUE_ID), __VA_ARGS__ )
+
+// The address of `hit` as a template argument is an odr-use, which instantiates it along with the
+// enclosing specialization; `used` then makes the compiler emit it, and its record, regardless.
+#define ST_COVERAGE_POINT_impl_( name, ... )                                                \
+    struct name {                                                                           \
+        __attribute__((used)) static void hit() {                                           \
+            __attribute__((used)) static char const record[] =                              \
+                "[st-covered`" __FILE__ "`" BOOST_PP_STRINGIZE(__LINE__) "`"                \
+                ST_PP_STRINGIZE(__VA_ARGS__) "`]";                                          \
+        }                                                                                   \
+    };                                                                                      \
+    typedef st::detail::coverageAnchor_<&name::hit> BOOST_PP_CAT(name, _anchor)             \
+/**/
+
+ST_CONFIG_NAMESPACE_OPEN
+namespace detail {
+
+template< void (*)() > struct coverageAnchor_ {};
+
+} // namespace detail
+ST_CONFIG_NAMESPACE_CLOSE
+
+#else
+
+#define ST_COVERAGE_POINT( ... ) static_assert( true, "" )
+
+#endif
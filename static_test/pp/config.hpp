@@ -0,0 +1,46 @@
+/** 
+  @copyright S. Levent Yilmaz 2016
+  Distributed under the Boost Software License, Version 1.0.
+  See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt.
+*/
+
+#pragma once
+
+///@file
+/// Preprocessor capabilities the ST_PP facility adapts to
+
+#include <boost/preprocessor/config/config.hpp>
+
+
+/// @def ST_PP_CONFIG_FAST_PATH
+/// 1 when the preprocessor is conforming enough to expand variadic arguments directly (every
+/// compiler except the traditional Visual C++ preprocessor). Set to 0 to force the portable path,
+/// which goes through Boost.Preprocessor sequences and delayed expansions.
+#ifndef ST_PP_CONFIG_FAST_PATH
+#  if BOOST_PP_VARIADICS_MSVC
+#    define ST_PP_CONFIG_FAST_PATH 0
+#  else
+#    define ST_PP_CONFIG_FAST_PATH 1
+#  endif
+#endif
+
+
+/// @def ST_PP_HAS_VA_OPT
+/// 1 when `__VA_OPT__` is available (a C++20 preprocessor). Probed rather than assumed from
+/// `__cplusplus`, since some compilers claim C++20 before supporting it. Not probed at all before
+/// C++20, where `__VA_OPT__` is at best an extension that warns under -pedantic.
+#ifndef ST_PP_HAS_VA_OPT
+#  if defined(__cplusplus) && (__cplusplus > 201703L) && ST_PP_CONFIG_FAST_PATH
+#    define ST_PP_HAS_VA_OPT_THIRD_(a, b, c, ...) c
+#    define ST_PP_HAS_VA_OPT_PROBE_(...) ST_PP_HAS_VA_OPT_THIRD_(__VA_OPT__(,), 1, 0, ~)
+#    if ST_PP_HAS_VA_OPT_PROBE_(~)
+#      define ST_PP_HAS_VA_OPT 1
+#    else
+#      define ST_PP_HAS_VA_OPT 0
+#    endif
+#    undef ST_PP_HAS_VA_OPT_PROBE_
+#    undef ST_PP_HAS_VA_OPT_THIRD_
+#  else
+#    define ST_PP_HAS_VA_OPT 0
+#  endif
+#endif
@@ -7,6 +7,8 @@
 #pragma once
 
 
+#include "config.hpp"
+
 #include <boost/preprocessor/seq/elem.hpp>
 #include <boost/preprocessor/seq/size.hpp>
 #include <boost/preprocessor/seq/for_each_i.hpp>
@@ -58,7 +60,13 @@ Here is another slightly more interesting use case. We want a variadic macro to
 number of arguments in the call:
 @snippet tPreprocessor.cpp dox: delay-variadic-size
 */
-#define ST_PP_DELAY(macro,argsTuple) ST_PP_DELAY_N(1, macro, argsTuple)
+#if ST_PP_CONFIG_FAST_PATH
+// A conforming preprocessor needs no extra rescans: `macro argsTuple` is rescanned as a whole
+// after substitution anyway.
+#  define ST_PP_DELAY(macro,argsTuple) macro argsTuple
+#else
+#  define ST_PP_DELAY(macro,argsTuple) ST_PP_DELAY_N(1, macro, argsTuple)
+#endif
 
 
 /// Delay n-times. This is useful in recursive applications of variadic macros
@@ -10,6 +10,9 @@
 ///@file
 /// The missing bits from the Boost Preprocessor library
 
+#include "config.hpp"
+#include "variadic.hpp"
+
 #include <boost/preprocessor/seq/elem.hpp>
 #include <boost/preprocessor/seq/size.hpp>
 #include <boost/preprocessor/seq/for_each_i.hpp>
@@ -17,6 +20,9 @@
 #include <boost/preprocessor/stringize.hpp>
 #include <boost/preprocessor/comma_if.hpp>
 #include <boost/preprocessor/expr_if.hpp>
+#include <boost/preprocessor/variadic/to_seq.hpp>
+#include <boost/preprocessor/variadic/size.hpp>
+#include <boost/preprocessor/cat.hpp>
 
 
 #ifndef BOOST_PP_VARIADICS
@@ -32,6 +38,85 @@
 
 /// Stringize variable number of arguments, including the comma
 /// E.g. `ST_PP_STRINGIZE( a,b,c )` becomes  `"a,b,c"`
+///
+/// Each argument is stringized on its own and joined with bare commas, so the result doesn't
+/// depend on the spacing around the commas as written (`a, b,c` is also `"a,b,c"`). On a
+/// conforming preprocessor (ST_PP_CONFIG_FAST_PATH) that is one macro per argument, picked by the
+/// count; the portable path goes through a Boost.PP sequence. Up to 64 arguments.
+#if ST_PP_CONFIG_FAST_PATH
+
+#define ST_PP_STRINGIZE(...) ST_PP_STRINGIZE_impl_(BOOST_PP_VARIADIC_SIZE(__VA_ARGS__), __VA_ARGS__)
+#define ST_PP_STRINGIZE_R(r, ...) ST_PP_STRINGIZE(__VA_ARGS__)
+#define ST_PP_STRINGIZE_impl_(n, ...) BOOST_PP_CAT(ST_PP_STRINGIZE_, n)(__VA_ARGS__)
+
+#define ST_PP_STRINGIZE_0() ""
+#define ST_PP_STRINGIZE_1(a) #a
+#define ST_PP_STRINGIZE_2(a, ...) #a "," ST_PP_STRINGIZE_1(__VA_ARGS__)
+#define ST_PP_STRINGIZE_3(a, ...) #a "," ST_PP_STRINGIZE_2(__VA_ARGS__)
+#define ST_PP_STRINGIZE_4(a, ...) #a "," ST_PP_STRINGIZE_3(__VA_ARGS__)
+#define ST_PP_STRINGIZE_5(a, ...) #a "," ST_PP_STRINGIZE_4(__VA_ARGS__)
+#define ST_PP_STRINGIZE_6(a, ...) #a "," ST_PP_STRINGIZE_5(__VA_ARGS__)
+#define ST_PP_STRINGIZE_7(a, ...) #a "," ST_PP_STRINGIZE_6(__VA_ARGS__)
+#define ST_PP_STRINGIZE_8(a, ...) #a "," ST_PP_STRINGIZE_7(__VA_ARGS__)
+#define ST_PP_STRINGIZE_9(a, ...) #a "," ST_PP_STRINGIZE_8(__VA_ARGS__)
+#define ST_PP_STRINGIZE_10(a, ...) #a "," ST_PP_STRINGIZE_9(__VA_ARGS__)
+#define ST_PP_STRINGIZE_11(a, ...) #a "," ST_PP_STRINGIZE_10(__VA_ARGS__)
+#define ST_PP_STRINGIZE_12(a, ...) #a "," ST_PP_STRINGIZE_11(__VA_ARGS__)
+#define ST_PP_STRINGIZE_13(a, ...) #a "," ST_PP_STRINGIZE_12(__VA_ARGS__)
+#define ST_PP_STRINGIZE_14(a, ...) #a "," ST_PP_STRINGIZE_13(__VA_ARGS__)
+#define ST_PP_STRINGIZE_15(a, ...) #a "," ST_PP_STRINGIZE_14(__VA_ARGS__)
+#define ST_PP_STRINGIZE_16(a, ...) #a "," ST_PP_STRINGIZE_15(__VA_ARGS__)
+#define ST_PP_STRINGIZE_17(a, ...) #a "," ST_PP_STRINGIZE_16(__VA_ARGS__)
+#define ST_PP_STRINGIZE_18(a, ...) #a "," ST_PP_STRINGIZE_17(__VA_ARGS__)
+#define ST_PP_STRINGIZE_19(a, ...) #a "," ST_PP_STRINGIZE_18(__VA_ARGS__)
+#define ST_PP_STRINGIZE_20(a, ...) #a "," ST_PP_STRINGIZE_19(__VA_ARGS__)
+#define ST_PP_STRINGIZE_21(a, ...) #a "," ST_PP_STRINGIZE_20(__VA_ARGS__)
+#define ST_PP_STRINGIZE_22(a, ...) #a "," ST_PP_STRINGIZE_21(__VA_ARGS__)
+#define ST_PP_STRINGIZE_23(a, ...) #a "," ST_PP_STRINGIZE_22(__VA_ARGS__)
+#define ST_PP_STRINGIZE_24(a, ...) #a "," ST_PP_STRINGIZE_23(__VA_ARGS__)
+#define ST_PP_STRINGIZE_25(a, ...) #a "," ST_PP_STRINGIZE_24(__VA_ARGS__)
+#define ST_PP_STRINGIZE_26(a, ...) #a "," ST_PP_STRINGIZE_25(__VA_ARGS__)
+#define ST_PP_STRINGIZE_27(a, ...) #a "," ST_PP_STRINGIZE_26(__VA_ARGS__)
+#define ST_PP_STRINGIZE_28(a, ...) #a "," ST_PP_STRINGIZE_27(__VA_ARGS__)
+#define ST_PP_STRINGIZE_29(a, ...) #a "," ST_PP_STRINGIZE_28(__VA_ARGS__)
+#define ST_PP_STRINGIZE_30(a, ...) #a "," ST_PP_STRINGIZE_29(__VA_ARGS__)
+#define ST_PP_STRINGIZE_31(a, ...) #a "," ST_PP_STRINGIZE_30(__VA_ARGS__)
+#define ST_PP_STRINGIZE_32(a, ...) #a "," ST_PP_STRINGIZE_31(__VA_ARGS__)
+#define ST_PP_STRINGIZE_33(a, ...) #a "," ST_PP_STRINGIZE_32(__VA_ARGS__)
+#define ST_PP_STRINGIZE_34(a, ...) #a "," ST_PP_STRINGIZE_33(__VA_ARGS__)
+#define ST_PP_STRINGIZE_35(a, ...) #a "," ST_PP_STRINGIZE_34(__VA_ARGS__)
+#define ST_PP_STRINGIZE_36(a, ...) #a "," ST_PP_STRINGIZE_35(__VA_ARGS__)
+#define ST_PP_STRINGIZE_37(a, ...) #a "," ST_PP_STRINGIZE_36(__VA_ARGS__)
+#define ST_PP_STRINGIZE_38(a, ...) #a "," ST_PP_STRINGIZE_37(__VA_ARGS__)
+#define ST_PP_STRINGIZE_39(a, ...) #a "," ST_PP_STRINGIZE_38(__VA_ARGS__)
+#define ST_PP_STRINGIZE_40(a, ...) #a "," ST_PP_STRINGIZE_39(__VA_ARGS__)
+#define ST_PP_STRINGIZE_41(a, ...) #a "," ST_PP_STRINGIZE_40(__VA_ARGS__)
+#define ST_PP_STRINGIZE_42(a, ...) #a "," ST_PP_STRINGIZE_41(__VA_ARGS__)
+#define ST_PP_STRINGIZE_43(a, ...) #a "," ST_PP_STRINGIZE_42(__VA_ARGS__)
+#define ST_PP_STRINGIZE_44(a, ...) #a "," ST_PP_STRINGIZE_43(__VA_ARGS__)
+#define ST_PP_STRINGIZE_45(a, ...) #a "," ST_PP_STRINGIZE_44(__VA_ARGS__)
+#define ST_PP_STRINGIZE_46(a, ...) #a "," ST_PP_STRINGIZE_45(__VA_ARGS__)
+#define ST_PP_STRINGIZE_47(a, ...) #a "," ST_PP_STRINGIZE_46(__VA_ARGS__)
+#define ST_PP_STRINGIZE_48(a, ...) #a "," ST_PP_STRINGIZE_47(__VA_ARGS__)
+#define ST_PP_STRINGIZE_49(a, ...) #a "," ST_PP_STRINGIZE_48(__VA_ARGS__)
+#define ST_PP_STRINGIZE_50(a, ...) #a "," ST_PP_STRINGIZE_49(__VA_ARGS__)
+#define ST_PP_STRINGIZE_51(a, ...) #a "," ST_PP_STRINGIZE_50(__VA_ARGS__)
+#define ST_PP_STRINGIZE_52(a, ...) #a "," ST_PP_STRINGIZE_51(__VA_ARGS__)
+#define ST_PP_STRINGIZE_53(a, ...) #a "," ST_PP_STRINGIZE_52(__VA_ARGS__)
+#define ST_PP_STRINGIZE_54(a, ...) #a "," ST_PP_STRINGIZE_53(__VA_ARGS__)
+#define ST_PP_STRINGIZE_55(a, ...) #a "," ST_PP_STRINGIZE_54(__VA_ARGS__)
+#define ST_PP_STRINGIZE_56(a, ...) #a "," ST_PP_STRINGIZE_55(__VA_ARGS__)
+#define ST_PP_STRINGIZE_57(a, ...) #a "," ST_PP_STRINGIZE_56(__VA_ARGS__)
+#define ST_PP_STRINGIZE_58(a, ...) #a "," ST_PP_STRINGIZE_57(__VA_ARGS__)
+#define ST_PP_STRINGIZE_59(a, ...) #a "," ST_PP_STRINGIZE_58(__VA_ARGS__)
+#define ST_PP_STRINGIZE_60(a, ...) #a "," ST_PP_STRINGIZE_59(__VA_ARGS__)
+#define ST_PP_STRINGIZE_61(a, ...) #a "," ST_PP_STRINGIZE_60(__VA_ARGS__)
+#define ST_PP_STRINGIZE_62(a, ...) #a "," ST_PP_STRINGIZE_61(__VA_ARGS__)
+#define ST_PP_STRINGIZE_63(a, ...) #a "," ST_PP_STRINGIZE_62(__VA_ARGS__)
+#define ST_PP_STRINGIZE_64(a, ...) #a "," ST_PP_STRINGIZE_63(__VA_ARGS__)
+
+#else
+
 #define ST_PP_STRINGIZE(...) \
    BOOST_PP_SEQ_FOR_EACH_I( ST_PP_STRINGIZE_m_, ~ , BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__) )
 
@@ -41,6 +126,8 @@
 
 #define ST_PP_STRINGIZE_m_(r,_,i,elem) BOOST_PP_EXPR_IF(i, "," ) BOOST_PP_STRINGIZE(elem)
 
+#endif
+
 
 /// Returns the arguments verbatim, including any commas
 /// E.g. `ST_PP_IDENTITY( pair<int,double> )` expands to `pair<int,double>`
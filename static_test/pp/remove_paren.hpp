@@ -39,6 +39,21 @@ BOOST_IDENTITY_TYPE macro suffers from the following limitations:
    in its implementation (which is a hack over function argument types).
 */
 
+#if ST_PP_CONFIG_FAST_PATH
+
+// Accept any number of arguments or one parenthesized argument, then
+// 1. "eat away" the parenthesis with recursive call to DEPAREN
+// 2. Paste EAT_ onto the leading tail of the recursion, which is always the first token of the
+//    (by then fully expanded) argument list. Pasting touches only that first token, so the user
+//    arguments, commas and all, come out untouched.
+#define ST_PP_REMOVE_PAREN(...) \
+    ST_PP_REMOVE_PAREN_impl_EATDEPAREN( ST_PP_REMOVE_PAREN_impl_DEPAREN_0 __VA_ARGS__ )
+
+#define ST_PP_REMOVE_PAREN_impl_EATDEPAREN(...) ST_PP_REMOVE_PAREN_impl_PASTE_EAT(__VA_ARGS__)
+#define ST_PP_REMOVE_PAREN_impl_PASTE_EAT(...) EAT_ ## __VA_ARGS__
+
+#else
+
 // Accept any number of arguments or one parenthesized argument, then
 // 1. "eat away" the parenthesis with recursive call to DEPAREN
 // 2. Delayed call to EATDEPAREN_AND_ENUM. Delayed call is required to circumvent
@@ -46,6 +61,8 @@ BOOST_IDENTITY_TYPE macro suffers from the following limitations:
 #define ST_PP_REMOVE_PAREN(...) \
     ST_PP_DELAY( ST_PP_REMOVE_PAREN_impl_EATDEPAREN_AND_ENUM, (ST_PP_REMOVE_PAREN_impl_DEPAREN_0 __VA_ARGS__) )
 
+#endif
+
 // Arguments are the tail of recursive DEPAREN and one or more comma separated user arguments to REMOVE_PAREN
 #define ST_PP_REMOVE_PAREN_impl_EATDEPAREN_AND_ENUM(...) \
     ST_PP_REMOVE_PAREN_impl_CAT_FIRST_TWO_ENUM_REST( (EAT_)BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__) )
@@ -0,0 +1,51 @@
+/** 
+  @copyright S. Levent Yilmaz 2016
+  Distributed under the Boost Software License, Version 1.0.
+  See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt.
+*/
+
+#pragma once
+
+///@file
+/// Variadic argument counting that gets the empty argument list right
+
+#include "config.hpp"
+
+#if !ST_PP_HAS_VA_OPT
+#  include <boost/preprocessor/control/iif.hpp>
+#  include <boost/preprocessor/facilities/is_empty_variadic.hpp>
+#  include <boost/preprocessor/variadic/size.hpp>
+#endif
+
+
+/// Number of arguments, 0 for an empty argument list (up to 63 arguments)
+/**
+Unlike BOOST_PP_VARIADIC_SIZE, which can't tell `()` from `(x)`:
+@code
+ST_PP_VARIADIC_SIZE()        // 0
+ST_PP_VARIADIC_SIZE(a)       // 1
+ST_PP_VARIADIC_SIZE(a, b, c) // 3
+@endcode
+
+With a C++20 preprocessor this is a single argument-shift expansion through `__VA_OPT__`.
+Otherwise it falls back to BOOST_PP_IS_EMPTY, which has a known blind spot: an argument list
+ending in the name of a function-like macro (e.g. `ST_PP_VARIADIC_SIZE(a, BOOST_PP_CAT)`) is
+miscounted.
+*/
+#if ST_PP_HAS_VA_OPT
+#  define ST_PP_VARIADIC_SIZE(...)                                                  \
+     ST_PP_VARIADIC_SIZE_impl_(__VA_OPT__(__VA_ARGS__,)                                \
+       63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48,  \
+       47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32,  \
+       31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16,  \
+       15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, ~)
+#  define ST_PP_VARIADIC_SIZE_impl_(                                                 \
+       _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16,  \
+       _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32,  \
+       _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48,  \
+       _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63,  \
+       size, ...) size
+#else
+#  define ST_PP_VARIADIC_SIZE(...) \
+     BOOST_PP_IIF(BOOST_PP_IS_EMPTY(__VA_ARGS__), 0, BOOST_PP_VARIADIC_SIZE(__VA_ARGS__))
+#endif
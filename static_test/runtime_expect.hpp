@@ -0,0 +1,256 @@
+/**
+  @copyright S. Levent Yilmaz 2016
+  Distributed under the Boost Software License, Version 1.0.
+  See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt.
+*/
+
+#pragma once
+
+#include <static_test/static_expect.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#if ST_CONFIG_HAS_STRING_VIEW
+#  include <string_view>
+#endif
+
+///
+/**
+RUNTIME_EXPECT_THAT* are the statement forms of STATIC_EXPECT_THAT*, for tests that would rather
+report a failure at run time than break the build, e.g. so that an IDE's test runner lists it next
+to the others:
+
+@code
+    TEST( Traits, Widening ) {
+        RUNTIME_EXPECT_THAT( (std::common_type_t<int, long>), Is<long> );
+        RUNTIME_EXPECT_THAT_EXPR( 1 + 2L, Is<long> );
+    }
+@endcode
+
+The matcher is still evaluated at compile time; what runs is the reporting. A passing check costs a
+branch and a counter increment: the message is a string literal, and the type names are views into
+`__PRETTY_FUNCTION__`, located at compile time, so nothing is formatted, demangled or allocated.
+A failing check formats its report into a fixed, per-thread arena and hands it to the failure sink
+(by default, a write to stderr). The report starts with the same record as the structured
+static_assert message, so tools/st_log2json.py picks runtime failures out of test logs as well:
+
+    [st-failure`<file>`<line>`<matcher>`0:<argument 0>`...`] <message>, Type0 = <type name>...
+
+Each check evaluates to whether it passed.
+*/
+#define RUNTIME_EXPECT_THAT( ... )                                                          \
+     ST_RuntimeExpectThatImpl_do_(                                                          \
+        ST_StaticExpectThatImpl_ctor_( BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__),               \
+            ST_STATIC_EXPECT_THAT_idType_,                                                  \
+            st::detail::InvokeMatcher )                                                     \
+     )                                                                                      \
+/**/
+
+#define RUNTIME_EXPECT_THAT_EXPR( ... )                                                     \
+     ST_RuntimeExpectThatImpl_do_(                                                          \
+        ST_StaticExpectThatImpl_ctor_( BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__), decltype,     \
+            st::detail::InvokeMatcher )                                                     \
+     )                                                                                      \
+/**/
+
+//     +------------------------------------------------+
+//     |  Implementation of RUNTIME_EXPECT_THAT macros  |
+//     +------------------------------------------------+
+// Methods of the same StaticExpectThatImpl "class" (see static_expect.hpp). The matcher is invoked
+// right in the template argument list, which keeps the check a single expression.
+
+#define ST_RuntimeExpectThatImpl_do_(This)                                                  \
+    st::runtime::detail::check<                                                             \
+        ST_StaticExpectThatImpl_result_(This)                                               \
+        ST_StaticExpectThatImpl_ttypeList_(This)                                            \
+    >(                                                                                      \
+        ST_RuntimeExpectThatImpl_record_(This),                                             \
+        ST_StaticExpectThatImpl_assertMsg_(This)                                            \
+    )                                                                                       \
+/**/
+
+// The structured record, always
+#define ST_RuntimeExpectThatImpl_record_(This)                                              \
+    "[st-failure`" __FILE__ "`" BOOST_PP_STRINGIZE(__LINE__) "`"                            \
+    ST_PP_STRINGIZE( ST_PP_REMOVE_PAREN( ST_StaticExpectThatImpl_matcher_(This) ) ) "`"     \
+    BOOST_PP_SEQ_FOR_EACH_I( ST_StaticExpectThatImpl_record_m_, ~,                          \
+                             ST_StaticExpectThatImpl_args_(This) )                          \
+    "]"                                                                                     \
+/**/
+
+#ifndef ST_StaticExpectThatImpl_record_m_
+#define ST_StaticExpectThatImpl_record_m_(r, _, i, arg) #i ":" ST_PP_STRINGIZE(arg) "`"
+#endif
+
+
+ST_CONFIG_NAMESPACE_OPEN
+namespace runtime {
+
+// A view of characters, not necessarily null terminated. Converts to std::string_view in C++17.
+struct text {
+    char const* data;
+    std::size_t size;
+
+#if ST_CONFIG_HAS_STRING_VIEW
+    constexpr operator std::string_view() const { return std::string_view(data, size); }
+#endif
+};
+
+// A failed check, as handed to the sink. `report` lives in the arena, and is only good until the
+// next failure on the same thread; `types` lives in the frame of the check, and is only good until
+// the sink returns. Unlike STATIC_EXPECT_THAT, which shows at most
+// ST_STATIC_EXPECT_CONFIG_NUM_MATCHER_ARGS types, there is no limit on their number.
+struct failure {
+    text record;                                                //< [st-failure`...`]
+    text message;                                               //< the static_assert message
+    text const* types;                                          //< names of the argument types
+    std::size_t numTypes;
+    text report;                                                //< all of the above, formatted
+};
+
+using sink_fn = void (*)( failure const& );
+
+struct counters {
+    unsigned long long checks;
+    unsigned long long failures;
+};
+
+namespace detail {
+
+//===-  [Type names]  -===//
+// The name of T is a slice of the signature of signatureOf_<T>(), at the same offsets as `double`
+// is in that of signatureOf_<double>(). A function template, not a member of a class template,
+// since only then do GCC, Clang and MSVC all spell T once: `signatureOf_() [with T = double]`,
+// `signatureOf_() [T = double]`, `signatureOf_<double>(void)`. Found at compile time (C++11
+// constexpr, hence the recursion); taken at run time, it is a pointer and a size.
+#if defined(ST_CONFIG_MSVC)
+#  define ST_RUNTIME_FUNCTION_SIGNATURE_ __FUNCSIG__
+#else
+#  define ST_RUNTIME_FUNCTION_SIGNATURE_ __PRETTY_FUNCTION__
+#endif
+
+template< class T >
+constexpr text signatureOf_() {
+    return text{ ST_RUNTIME_FUNCTION_SIGNATURE_, sizeof(ST_RUNTIME_FUNCTION_SIGNATURE_) - 1 };
+}
+
+#undef ST_RUNTIME_FUNCTION_SIGNATURE_
+
+constexpr bool startsWith_( char const* s, char const* prefix ) {
+    return *prefix == '\0' || (*s == *prefix && startsWith_(s + 1, prefix + 1));
+}
+
+constexpr std::size_t find_( text s, char const* needle, std::size_t i = 0 ) {
+    return i == s.size || startsWith_(s.data + i, needle) ? i : find_(s, needle, i + 1);
+}
+
+constexpr std::size_t namePrefix_ = find_( signatureOf_<double>(), "double" );
+constexpr std::size_t nameSuffix_ = signatureOf_<double>().size - namePrefix_ - 6;
+
+// A second probe, of another length, must be found at the same offsets
+static_assert( find_( signatureOf_<unsigned char>(), "unsigned char" ) == namePrefix_ &&
+               signatureOf_<unsigned char>().size - namePrefix_ - 13 == nameSuffix_,
+               "st::runtime: this compiler does not spell type names at a fixed place in signatures" );
+
+template< class T >
+constexpr text typeName() {
+    return text{ signatureOf_<T>().data + namePrefix_,
+                 signatureOf_<T>().size - namePrefix_ - nameSuffix_ };
+}
+
+//===-  [State]  -===//
+inline counters& counters_() { static thread_local counters c = { 0, 0 }; return c; }
+
+inline void writeToStderr( failure const& f );
+inline sink_fn& sink_() { static sink_fn s = &writeToStderr; return s; }
+
+// The arena failure reports are formatted into
+struct arena {
+    char buffer[ST_STATIC_EXPECT_CONFIG_RUNTIME_ARENA_SIZE];
+    std::size_t used;
+
+    // Append as much of s as fits, keeping a byte for the terminating null
+    void append( char const* s, std::size_t n ) {
+        std::size_t room = sizeof(buffer) - 1 - used;
+        n = n < room ? n : room;
+        std::memcpy(buffer + used, s, n);
+        used += n;
+        buffer[used] = '\0';
+    }
+    void append( text s ) { append(s.data, s.size); }
+    void append( char const* s ) { append(s, std::strlen(s)); }
+    void appendNumber( std::size_t n ) {
+        if (n >= 10)
+            appendNumber(n / 10);
+        char const digit = static_cast<char>('0' + n % 10);
+        append(&digit, 1);
+    }
+};
+
+inline arena& arena_() { static thread_local arena a; return a; }
+
+inline void writeToStderr( failure const& f ) {
+    std::fwrite(f.report.data, 1, f.report.size, stderr);
+    std::fputc('\n', stderr);
+}
+
+//===-  [Failure]  -===//
+// Out of line of the check, so that the passing path stays small
+template< std::size_t N >
+ST_CONFIG_NOINLINE void fail( char const* record, char const* message, text const (&types)[N] ) {
+    static char const* const prefix = BOOST_PP_STRINGIZE(ST_STATIC_EXPECT_CONFIG_TYPEDISPLAY_PREFIX);
+
+    arena& a = arena_();
+    a.used = 0;
+    a.append(record);
+    a.append(" ");
+    a.append(message);
+    for (std::size_t i = 0; i != N; ++i) {
+        a.append(", ");
+        a.append(prefix);
+        a.appendNumber(i);
+        a.append(" = ");
+        a.append(types[i]);
+    }
+
+    failure f;
+    f.record  = text{ record, std::strlen(record) };
+    f.message = text{ message, std::strlen(message) };
+    f.types   = types;
+    f.numTypes = N;
+    f.report  = text{ a.buffer, a.used };
+
+    ++counters_().failures;
+    sink_()(f);
+}
+
+template< class Result, class... T >
+inline bool check( char const* record, char const* message ) {
+    ++counters_().checks;
+    if (Result::value)
+        return true;
+    // compile time constants; held in an array, of any size, only on the way to the failure report
+    text const types[] = { typeName<T>()... };
+    fail(record, message, types);
+    return false;
+}
+
+} // namespace detail
+
+// Where failures go; returns the previous sink
+inline sink_fn setFailureSink( sink_fn s ) {
+    sink_fn previous = detail::sink_();
+    detail::sink_() = s;
+    return previous;
+}
+
+// Checks and failures so far, on the calling thread
+inline counters const& stats() { return detail::counters_(); }
+
+// Name of T, as the compiler spells it
+template< class T >
+constexpr text typeName() { return detail::typeName<T>(); }
+
+} // namespace runtime
+ST_CONFIG_NAMESPACE_CLOSE
@@ -7,25 +7,25 @@
 #pragma once
 
 #include <static_test/config.hpp>
+#include <static_test/coverage.hpp>
 #include <static_test/pp/misc.hpp>
 #include <static_test/pp/remove_paren.hpp>
 
-#include <boost/utility/identity_type.hpp>
 #include <boost/preprocessor/variadic.hpp>
 #include <boost/preprocessor/seq/enum.hpp>
-#include <boost/preprocessor/seq/elem.hpp>
+#include <boost/preprocessor/seq/seq.hpp>
 #include <boost/preprocessor/seq/pop_back.hpp>
 #include <boost/preprocessor/seq/size.hpp>
 #include <boost/preprocessor/dec.hpp>
 #include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/stringize.hpp>
 #include <boost/preprocessor/seq/for_each_i.hpp>
-#include <boost/preprocessor/control/expr_if.hpp>
-#include <boost/preprocessor/control/expr_iif.hpp>
-#include <boost/preprocessor/for.hpp>
+#include <boost/preprocessor/control/if.hpp>
+#include <boost/preprocessor/tuple/elem.hpp>
+#include <boost/preprocessor/repetition/enum_params.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
 
-#include <boost/mpl/placeholders.hpp>
-#include <boost/mpl/vector.hpp>
-#include <boost/mpl/accumulate.hpp>
+#include <cstddef>
 #include <type_traits>
 
 
@@ -120,7 +120,7 @@ Finally, the meta-function
 
 #define STATIC_EXPECT_FALSE( boolConstant )                                     \
     ST_STATIC_EXPECT_assert(                                         \
-       !BOOST_IDENTITY_TYPE((boolConstant))::value  ,                           \
+       !ST_PP_REMOVE_PAREN(boolConstant)::value  ,                             \
        ST_STATIC_EXPECT_quote_(#boolConstant) " is not false_type"    \
 )
 
@@ -192,19 +192,6 @@ Finally, the meta-function
 
 
 
-namespace detail {
-
-template<class MetaFcn, class ... T>
-struct InvokeMatcher
-        : boost::mpl::apply<MetaFcn, T...>
-          ::type // call meta-predicate
-          ::type // become a bool_constant
-{};
-
-} // namespace detail
-
-
-
 //     +-----------------------+
 //     |  STATIC_EXPECT_THAT*  |
 //     +-----------------------+
@@ -212,16 +199,105 @@ struct InvokeMatcher
 #define STATIC_EXPECT_THAT( ... )                                             \
      ST_StaticExpectThatImpl_do_(                                             \
         ST_StaticExpectThatImpl_ctor_( BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__), \
-            ST_STATIC_EXPECT_THAT_idType_ )                                   \
+            ST_STATIC_EXPECT_THAT_idType_,                                    \
+            st::detail::InvokeMatcher )                                       \
 )                                                                             \
 /**/
 
 #define STATIC_EXPECT_THAT_EXPR( ... )                                                            \
      ST_StaticExpectThatImpl_do_(                                                        \
-        ST_StaticExpectThatImpl_ctor_( BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__), decltype ) \
+        ST_StaticExpectThatImpl_ctor_( BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__), decltype,  \
+            st::detail::InvokeMatcher )                                                  \
      )                                                                                            \
 /**/
 
+// Like STATIC_EXPECT_THAT_EXPR, but the matcher sees the constant *value* of each expression rather
+// than its type. Each argument becomes an integral_constant-like type with a static `value` member,
+// so the value matchers (Eq, Lt, InRange..) work the same for integral constants and for constant
+// expressions:
+//
+//    constexpr int sq(int x) { return x*x; }
+//    STATIC_EXPECT_THAT_VALUE( sq(3), Eq<9> );
+//
+// With C++17 the value is carried by an `auto` non-type template parameter, so its type is deduced
+// (and with C++20 it may also be of a structural class type). Otherwise it has to be an integral or
+// enumeration constant.
+#define STATIC_EXPECT_THAT_VALUE( ... )                                                     \
+     ST_StaticExpectThatImpl_do_(                                                           \
+        ST_StaticExpectThatImpl_ctor_( BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__),               \
+            ST_STATIC_EXPECT_THAT_valType_,                                                 \
+            st::detail::InvokeMatcher )                                                     \
+     )                                                                                      \
+/**/
+
+// All the STATIC_EXPECT_THAT* macros are usable at namespace, class and function scope alike.
+// They expand to static_asserts right in that scope and declare no names, so any number of them
+// may share a line, and a class template or inline function in a header is the same sequence of
+// tokens in every translation unit. Within a template the compiler checks an assertion that does
+// not depend on the template parameters once, at the definition; the dependent ones are checked
+// with every specialization of the enclosing class or function template.
+//
+// When the dependent checks of a class template are too many to pay for on every implicit
+// instantiation, defer them. A deferred assertion lives in a nested struct which is only
+// instantiated along with an explicit instantiation of its enclosing class template:
+//
+//    template<class T> struct Policy {
+//        STATIC_EXPECT_DEFERRED( STATIC_EXPECT_THAT( (Policy<T>), SizeIs<8> ) );
+//    };
+//    template struct Policy<int>;   // checked for int only; Policy<long> is never checked
+//
+// At namespace and function scope a deferred assertion is checked right away. The nested struct is
+// named after ST_STATIC_EXPECT_CONFIG_UNIQUE_ID, the line by default: put the assertions deferred
+// on one line into a single STATIC_EXPECT_DEFERRED, separated by semicolons.
+#define STATIC_EXPECT_DEFERRED( ... )                                                       \
+     struct BOOST_PP_CAT( ST_StaticExpectDeferred_, ST_STATIC_EXPECT_CONFIG_UNIQUE_ID ) {   \
+         __VA_ARGS__;                                                                       \
+     }                                                                                      \
+/**/
+
+// Give a matcher a name of its own, to be shared by many assertions:
+//
+//    ST_DEFINE_MATCHER( IsRegistry, (Is<std::tuple<Entry<0>, Entry<1>, .., Entry<99>>>) );
+//
+//    STATIC_EXPECT_THAT( make_registry_t<..>, IsRegistry );
+//    STATIC_EXPECT_THAT( decltype(registry), IsRegistry );
+//
+// The matcher expression is parsed once, at the definition, and failure messages (the static_assert
+// and the instantiation backtrace alike) read `IsRegistry` rather than the expression spelled out.
+// Unlike an alias, the name is a distinct class, derived from the matcher, so the compiler can't
+// look through it. The matcher has to be a metafunction class, as all static_matchers are; wrap an
+// MPL lambda expression in boost::mpl::lambda<..>::type. Precede by a template header to define a
+// family of matchers:
+//
+//    template<class T> ST_DEFINE_MATCHER( IsPairOf, (Is<std::pair<T, T>>) );
+#define ST_DEFINE_MATCHER( name, ... )                                                      \
+    struct name : ST_PP_REMOVE_PAREN(__VA_ARGS__) {}                                        \
+/**/
+
+// Check a matcher for every combination of types drawn one from each of the parenthesized lists:
+//
+//    STATIC_FOR_ALL( (signed char, short, int, long), (float, double), IsConvertible );
+//
+// is the same as the eight STATIC_EXPECT_THAT( signed char, float, IsConvertible ) ... but costs
+// a single static_assert over one pack expansion, with instantiations linear in the number of
+// combinations. A failure names the first failing combination, as Type0, Type1.. as usual.
+//
+// The lists hold types; qualifiers and other type transformations are spelled as Transform<F>
+// elements (AsIs, AddConst, AddVolatile, AddCV.. for the usual ones), each of which applies to the
+// type drawn from the list before it, rather than being an argument of its own:
+//
+//    STATIC_FOR_ALL( (short, int, long), (AsIs, AddConst, AddVolatile, AddCV), Matcher );
+//
+// checks the one-argument Matcher for short, short const, .. long const volatile. A failure shows
+// the type and the transform, e.g. `Type0<long>` and `Type1<Transform<std::add_cv>>`.
+#define STATIC_FOR_ALL( ... )                                                               \
+     ST_StaticForAllImpl_do_(                                                               \
+        ST_StaticExpectThatImpl_ctor_( BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__),               \
+            ST_StaticForAllImpl_listType_,                                                  \
+            st::detail::ForAll )                                                            \
+     )                                                                                      \
+/**/
+
 //     +-----------------------------------------------+
 //     |  Implementation of STATIC_EXPECT_THAT macros  |
 //     +-----------------------------------------------+
@@ -239,26 +315,29 @@ struct InvokeMatcher
 
 
 //===-  [Constructor]  -===//
-// The "class" state is the following triplet:
+// The "class" state is the following quadruplet:
 // 1. The Matcher (last argument of STATIC_EXPECT_THAT macros)
 // 2. The arguments "container" (remaining of the arguments to STATIC_EXPECT_THAT macros converted to a Boost.PP Sequence)
 // 3. Specific to each STATIC_EXPECT_THAT macro, the "callable" which specifies how to convert an
 //    argument to a type. Callable is some expression which is valid when followed by `(arg)`, where
 //    `arg` is an element of the arguments container.
-#define ST_StaticExpectThatImpl_initTuple_( userArgsSeq, arg2type )  ( \
-    ST_PP_SEQ_BACK (userArgsSeq),                                      \
-    BOOST_PP_SEQ_POP_BACK(userArgsSeq),                                \
-    arg2type                                                           \
-)                                                                      \
+// 4. The "evaluator", a template which applies the matcher to the types as `eval<Matcher, T...>`
+//    (st::detail::InvokeMatcher, or st::detail::ForAll for STATIC_FOR_ALL)
+#define ST_StaticExpectThatImpl_initTuple_( userArgsSeq, arg2type, eval )  ( \
+    ST_PP_SEQ_BACK (userArgsSeq),                                          \
+    BOOST_PP_SEQ_POP_BACK(userArgsSeq),                                    \
+    arg2type,                                                              \
+    eval                                                                   \
+)                                                                          \
 /**/
 
-#define ST_StaticExpectThatImpl_ctor_( userArgsSeq, arg2type ) \
-ST_StaticExpectThatImpl_initTuple_                             \
-    BOOST_PP_IF(                                               \
-       BOOST_PP_DEC(BOOST_PP_SEQ_SIZE(userArgsSeq)),           \
-       (userArgsSeq, arg2type),                                \
-       (BOOST_PP_SEQ_HEAD(userArgsSeq), arg2type )             \
-    )                                                          \
+#define ST_StaticExpectThatImpl_ctor_( userArgsSeq, arg2type, eval ) \
+ST_StaticExpectThatImpl_initTuple_                                 \
+    BOOST_PP_IF(                                                   \
+       BOOST_PP_DEC(BOOST_PP_SEQ_SIZE(userArgsSeq)),               \
+       (userArgsSeq, arg2type, eval),                              \
+       (BOOST_PP_SEQ_HEAD(userArgsSeq), arg2type, eval )           \
+    )                                                              \
 /**/
 
 
@@ -273,20 +352,27 @@ ST_StaticExpectThatImpl_initTuple_                             \
 // The "callable" which converts the arguments to types (callable is C will be expanded to C(arg) for each argument)
 #define ST_StaticExpectThatImpl_toType_( This ) BOOST_PP_TUPLE_ELEM(4, 2, This )
 
+// The evaluator
+#define ST_StaticExpectThatImpl_eval_( This ) BOOST_PP_TUPLE_ELEM(4, 3, This )
 
-//===-  [Number of arguments]  -===//
-#define ST_StaticExpectThatImpl_numArgs_(This)              \
-   BOOST_PP_SEQ_SIZE( ST_StaticExpectThatImpl_args_(This) ) \
-/**/
 
-//===-  [Invoke Matcher]  -===//
-#define ST_StaticExpectThatImpl_invokeMatcher_(This)                           \
-  using matcherResult =                                                        \
-      st::detail::InvokeMatcher</* remove parenthesis guarding Matcher with    \
-                                   commas in it */                             \
+//===-  [Result]  -===//
+// The result of the matcher, a bool_constant. It is spelled out wherever it is needed rather than
+// given a name, since a name would have to be unique in the scope of the assertion; the compiler
+// instantiates it once all the same. Within a loop over the arguments it can't be expanded (the
+// loop macros are not reentrant), so the loops of the forged errors get it passed in, expanded.
+#define ST_StaticExpectThatImpl_result_(This)                                  \
+  ST_StaticExpectThatImpl_eval_(This)</* remove parenthesis guarding Matcher   \
+                                         with commas in it */                  \
                                 ST_PP_REMOVE_PAREN(                            \
                                     ST_StaticExpectThatImpl_matcher_(This))    \
-                                    ST_StaticExpectThatImpl_ttypeList_(This)>; \
+                                    ST_StaticExpectThatImpl_ttypeList_(This)>  \
+/**/
+
+
+//===-  [Number of arguments]  -===//
+#define ST_StaticExpectThatImpl_numArgs_(This)              \
+   BOOST_PP_SEQ_SIZE( ST_StaticExpectThatImpl_args_(This) ) \
 /**/
 
 //===-  [ typeList ]  -===//
@@ -299,15 +385,16 @@ ST_StaticExpectThatImpl_initTuple_                             \
 #define ST_StaticExpectThatImpl_ttypeList_m_(r, toType, i, arg) , toType(arg)
 
 //===-  [Static assert]  -===//
-// Expand to a static_assert
+// Expand to a static_assert (without the trailing semicolon)
 #if defined(ST_STATIC_EXPECT_CONFIG_STATIC_ASSERT) && (ST_STATIC_EXPECT_CONFIG_STATIC_ASSERT == 1)
 #define ST_StaticExpectThatImpl_staticAssert_( This )  \
     ST_STATIC_EXPECT_assert_(                             \
-        matcherResult::value,                                   \
+        ST_StaticExpectThatImpl_result_(This)::value,   \
+        ST_StaticExpectThatImpl_record_(This)               \
         ST_StaticExpectThatImpl_assertMsg_(This)            \
-    );                                                          
+    )
 #else
-#define ST_StaticExpectThatImpl_staticAssert_(This)
+#define ST_StaticExpectThatImpl_staticAssert_(This) static_assert( true, "" )
 #endif
 /**/
 
@@ -330,6 +417,23 @@ ST_StaticExpectThatImpl_initTuple_                             \
         )                                                                             \
 /**/
 
+// Machine readable record (see ST_STATIC_EXPECT_CONFIG_STRUCTURED_MESSAGE), or nothing
+#if ST_STATIC_EXPECT_CONFIG_STRUCTURED_MESSAGE
+#define ST_StaticExpectThatImpl_record_(This)                                         \
+    "[st-failure`" __FILE__ "`" BOOST_PP_STRINGIZE(__LINE__) "`"                        \
+    ST_PP_STRINGIZE( ST_PP_REMOVE_PAREN( ST_StaticExpectThatImpl_matcher_(This) ) ) "`" \
+    BOOST_PP_SEQ_FOR_EACH_I(                                                          \
+        ST_StaticExpectThatImpl_record_m_,                                            \
+        ~,                                                                            \
+        ST_StaticExpectThatImpl_args_(This)                                           \
+        )                                                                             \
+    "] "                                                                              \
+/**/
+#define ST_StaticExpectThatImpl_record_m_(r, _, i, arg) #i ":" ST_PP_STRINGIZE(arg) "`"
+#else
+#define ST_StaticExpectThatImpl_record_(This)
+#endif
+
 // "List" spec per argument:
 #ifdef ST_STATIC_EXPECT_CONFIG_USE_NEWLINES_IN_MESSAGE
 #   define ST_STATIC_EXPECT_listElem_m_(r, _, i, arg) "\n" BOOST_PP_STRINGIZE(ST_STATIC_EXPECT_CONFIG_TYPEDISPLAY_PREFIX) #i ": " BOOST_PP_STRINGIZE(arg)
@@ -342,53 +446,123 @@ ST_StaticExpectThatImpl_initTuple_                             \
 // Forge (fake out) an error into the compiler such that the error message includes in clear-text
 // the resolved type of the argument.
 // The forged error is an invalid access to a non-existent member type.
+// The loop over the arguments is passed `Forge`, the pair of This and the (parenthesized) result.
+#if defined(ST_STATIC_EXPECT_CONFIG_FORGED_ERROR) && (ST_STATIC_EXPECT_CONFIG_FORGED_ERROR == 1)
 #define ST_StaticExpectThatImpl_forgeError_(This) \
     BOOST_PP_SEQ_FOR_EACH_I_R(1,                      \
        ST_StaticExpectThatImpl_forgeError_m_,     \
-       This,                                          \
+       ST_StaticExpectThatImpl_forge_(This),          \
        ST_StaticExpectThatImpl_args_(This)   \
 )
+#else
+#define ST_StaticExpectThatImpl_forgeError_(This)
+#endif
 /**/
 
-#if 0
-#define ST_StaticExpectThatImpl_forgeError_m_(r, This,  i, arg)                         \
-   using t ## i =                                                                           \
-      st::detail::extractForgedErrorSentinel<                                  \
-          st::detail::                                                         \
-          BOOST_PP_CAT(ST_STATIC_EXPECT_CONFIG_TYPEDISPLAY_PREFIX, i) <               \
-              st::detail::t_<std::conditional<                                 \
-                  matcherResult::value,                                                     \
-                  st::detail::void_,  /* when-true */                          \
-                  ST_StaticExpectThatImpl_toType_(This)(arg)  /* when-false */     \
-              >> /* conditional select void_ or the type, when void_ no errors generated */ \
-          > /* The type is passed as specialization of Ti for i-th argument */              \
-      >; /* access the ::Sentinel to force the error */                                     \
+#define ST_StaticExpectThatImpl_forge_(This) ( This, (ST_StaticExpectThatImpl_result_(This)) )
+#define ST_StaticExpectThatImpl_forgeThis_(Forge) BOOST_PP_TUPLE_ELEM(2, 0, Forge)
+#define ST_StaticExpectThatImpl_forgeResult_(Forge) ST_PP_REMOVE_PAREN(BOOST_PP_TUPLE_ELEM(2, 1, Forge))
+
+// Each is a static_assert *preceded* by a semicolon, so the last one is terminated by the user's.
+// It always holds: the sentinel is void, or else the error is in reaching for it. The sentinel is
+// reached through an alias template, which works the same in dependent and non-dependent contexts.
+#define ST_StaticExpectThatImpl_forgeError_m_(r, Forge, i, arg)                                \
+   ; static_assert( std::is_void< st::detail::extractForgedErrorSentinel<                      \
+          st::detail::                                                                         \
+          BOOST_PP_CAT(ST_STATIC_EXPECT_CONFIG_TYPEDISPLAY_PREFIX, i) <                        \
+              ST_StaticExpectThatImpl_forgedType_(Forge, arg)                                  \
+          > /* The type is passed as specialization of Ti for i-th argument */                 \
+      > /* access the ::Sentinel to force the error */ >::value, "" )                          \
+/**/
+
+// Select void_ or the type; when void_ no errors are generated. What is shown of a failing type is
+// up to the matcher (see st::detail::shown_), and in the reduced-diagnostic mode, that is summarized.
+// Neither is computed for passing assertions: std::conditional picks between nullary
+// metafunctions, and only the one picked is evaluated.
+#if ST_STATIC_EXPECT_CONFIG_TYPE_SUMMARY
+#define ST_StaticExpectThatImpl_forgedType_(Forge, arg)                                        \
+    st::detail::t_<st::detail::t_<std::conditional<                                            \
+        ST_StaticExpectThatImpl_forgeResult_(Forge)::value,                                    \
+        st::detail::type_<st::detail::void_>,                                                  \
+        st::detail::summarizeLazy_< ST_StaticExpectThatImpl_shown_(                            \
+                                        ST_StaticExpectThatImpl_forgeThis_(Forge), arg),       \
+                                    ST_STATIC_EXPECT_CONFIG_TYPE_SUMMARY_DEPTH,                \
+                                    ST_STATIC_EXPECT_CONFIG_TYPE_SUMMARY_WIDTH >               \
+    >>>                                                                                        \
 /**/
 #else
-#define ST_StaticExpectThatImpl_forgeError_m_(r, This,  i, arg)                         \
-   using t ## i =                                                                           \
-          st::detail::                                                         \
-          BOOST_PP_CAT(ST_STATIC_EXPECT_CONFIG_TYPEDISPLAY_PREFIX, i) <               \
-              st::detail::t_<std::conditional<                                 \
-                  matcherResult::value,                                                     \
-                  st::detail::void_,  /* when-true */                          \
-                  ST_StaticExpectThatImpl_toType_(This)(arg)  /* when-false */     \
-              >> /* conditional select void_ or the type, when void_ no errors generated */ \
-          > /* The type is passed as specialization of Ti for i-th argument */              \
-      ::ST_STATIC_EXPECT_CONFIG_FORGED_ERROR_SENTINEL ; /* access the ::Sentinel to force the error */                   \
+#define ST_StaticExpectThatImpl_forgedType_(Forge, arg)                                        \
+    st::detail::t_<st::detail::t_<std::conditional<                                            \
+        ST_StaticExpectThatImpl_forgeResult_(Forge)::value,                                    \
+        st::detail::type_<st::detail::void_>,  /* when-true */                                 \
+        ST_StaticExpectThatImpl_shown_(ST_StaticExpectThatImpl_forgeThis_(Forge), arg)  /* when-false */ \
+    >>>                                                                                        \
 /**/
-
 #endif
 
+#define ST_StaticExpectThatImpl_shown_(This, arg)                                              \
+    st::detail::shown_< void, ST_PP_REMOVE_PAREN(ST_StaticExpectThatImpl_matcher_(This)),      \
+                        ST_StaticExpectThatImpl_toType_(This)(arg) >                           \
+/**/
+
 //===-  [do]  -===//
 
-// Finally: the top level call that brings everything together
+// Finally: the top level call that brings everything together. Declarations go straight into the
+// enclosing scope; the last one is left for the user to terminate with a semicolon.
 #define ST_StaticExpectThatImpl_do_(This)                            \
-    struct BOOST_PP_CAT( _ST_test_static_expect_local_str_ , __LINE__ ) {    \
-        ST_StaticExpectThatImpl_invokeMatcher_(This)                     \
-        ST_StaticExpectThatImpl_staticAssert_(This)                       \
-        ST_StaticExpectThatImpl_forgeError_(This)                         \
-    }                                                                         \
+    ST_StaticExpectThatImpl_staticAssert_(This)                      \
+    ST_StaticExpectThatImpl_forgeError_(This)                        \
+/**/
+
+
+//===-  [STATIC_FOR_ALL]  -===//
+// The same "class", where each argument is a list of types. The result is that of the matcher for
+// all combinations; the forged errors show the first combination that fails.
+#define ST_StaticForAllImpl_listType_(x) st::detail::list_< ST_PP_REMOVE_PAREN(x) >
+
+#define ST_StaticForAllImpl_do_(This)                                                       \
+    ST_StaticForAllImpl_staticAssert_(This)                                                 \
+    ST_StaticForAllImpl_forgeError_(This)                                                   \
+/**/
+
+#if defined(ST_STATIC_EXPECT_CONFIG_STATIC_ASSERT) && (ST_STATIC_EXPECT_CONFIG_STATIC_ASSERT == 1)
+#define ST_StaticForAllImpl_staticAssert_( This )                                           \
+    ST_STATIC_EXPECT_assert_(                                                               \
+        ST_StaticExpectThatImpl_result_(This)::value,                                       \
+        ST_StaticExpectThatImpl_record_(This)                                               \
+        ST_PP_STRINGIZE(                                                                    \
+            ST_PP_REMOVE_PAREN( ST_StaticExpectThatImpl_matcher_(This) )                    \
+            < BOOST_PP_ENUM_PARAMS(ST_StaticExpectThatImpl_numArgs_(This),                  \
+                                   ST_STATIC_EXPECT_CONFIG_TYPEDISPLAY_PREFIX) >            \
+        )                                                                                   \
+        " fails for a combination of:"                                                      \
+        BOOST_PP_SEQ_FOR_EACH_I( ST_STATIC_EXPECT_listElem_m_, ~,                           \
+                                 ST_StaticExpectThatImpl_args_(This) )                      \
+    )
+#else
+#define ST_StaticForAllImpl_staticAssert_(This) static_assert( true, "" )
+#endif
+
+#if defined(ST_STATIC_EXPECT_CONFIG_FORGED_ERROR) && (ST_STATIC_EXPECT_CONFIG_FORGED_ERROR == 1)
+#define ST_StaticForAllImpl_forgeError_(This)                                               \
+    BOOST_PP_SEQ_FOR_EACH_I_R(1, ST_StaticForAllImpl_forgeError_m_,                         \
+                              ST_StaticExpectThatImpl_forge_(This),                         \
+                              ST_StaticExpectThatImpl_args_(This))                          \
+/**/
+#else
+#define ST_StaticForAllImpl_forgeError_(This)
+#endif
+
+#define ST_StaticForAllImpl_forgeError_m_(r, Forge, i, arg)                                 \
+   ; static_assert( std::is_void< st::detail::extractForgedErrorSentinel<                   \
+          st::detail::BOOST_PP_CAT(ST_STATIC_EXPECT_CONFIG_TYPEDISPLAY_PREFIX, i) <         \
+              st::detail::t_<st::detail::t_<std::conditional<                               \
+                  ST_StaticExpectThatImpl_forgeResult_(Forge)::value,                       \
+                  st::detail::type_<st::detail::void_>,                                     \
+                  st::detail::forAllFailing_< ST_StaticExpectThatImpl_forgeResult_(Forge), i > \
+              >>>                                                                           \
+          >                                                                                 \
+      > >::value, "" )                                                                      \
 /**/
 
 
@@ -402,12 +576,23 @@ ST_StaticExpectThatImpl_initTuple_                             \
 // convert to a type expression valid as a template argument
 #define ST_STATIC_EXPECT_THAT_idType_(x) ST_PP_REMOVE_PAREN(x)
 //
+// Given a constant expression `x`, make it a type that carries its value as `::value`
+#if ST_CONFIG_HAS_AUTO_NTTP
+#  define ST_STATIC_EXPECT_THAT_valType_(x) st::detail::value_c< (x) >
+#else
+#  define ST_STATIC_EXPECT_THAT_valType_(x) \
+    std::integral_constant< st::detail::t_<std::decay<decltype(x)>>, (x) >
+#endif
+//
 #define ST_STATIC_EXPECT_assert_(x , msg )     \
     static_assert( x, "static failure: " msg "." )   \
     /**/
 #define ST_STATIC_EXPECT_quote_(x) "`" x "'"
 
 
+namespace static_matchers_impl {
+template< template<class...> class F > struct Transform;
+}
 
 namespace detail {
 
@@ -422,11 +607,197 @@ template< class T >
 using t_ = typename T::type;
 
 
+#if ST_CONFIG_HAS_AUTO_NTTP
+// The value-carrying type for STATIC_EXPECT_THAT_VALUE. Same interface as std::integral_constant,
+// but the value type is deduced, and (C++20) need not be integral.
+template< auto V >
+struct value_c {
+    using value_type = decltype(V);
+    using type = value_c;
+    static constexpr value_type value = V;
+    constexpr operator value_type() const { return value; }
+    constexpr value_type operator()() const { return value; }
+};
+#endif
+
+#if ST_CONFIG_HAS_CLASS_NTTP
+// A string literal as a structural value, so that it can be a template argument
+template< std::size_t N >
+struct fixed_string {
+    char chars[N];
+
+    constexpr fixed_string( char const (&s)[N] ) : chars{} {
+        for (std::size_t i = 0; i != N; ++i)
+            chars[i] = s[i];
+    }
+    constexpr char const* data() const { return chars; }
+    constexpr std::size_t size() const { return N - 1; }
+};
+
+// The string matchers' operand for a string literal, as in StartsWith<string_c<"SELECT ">>
+template< fixed_string S >
+struct string_c {
+    using type = string_c;
+    static constexpr decltype(S) value = S;
+};
+#endif
+
+
+template< bool... > struct bools_ {};
+
+template< bool... B >
+using anyOf_ = std::integral_constant< bool, !std::is_same< bools_<false, B...>, bools_<B..., false> >::value >;
+
+template<class...> struct voider_ { using type = void; };
+
+// An MPL lambda expression applied to T..., as boost::mpl::apply would, without MPL. A placeholder
+// (boost::mpl::_1.. are arg<1>.., metafunction classes of an int) is replaced by the argument it
+// picks, and a template instance with placeholders among its arguments by the ::type of its
+// instance with them replaced, e.g. std::is_same<_1, int> by std::is_same<T, int>::type. Anything
+// else stays as is. `bound` tells whether there were placeholders.
+template<class Void, class E, class... T>
+struct lambda_ {
+    using type = E;
+    using bound = std::false_type;
+};
+
+template<template<int> class Arg, int N, class... T>
+struct lambda_< t_<voider_<typename Arg<N>::template apply<T...>::type>>, Arg<N>, T... > {
+    using type = typename Arg<N>::template apply<T...>::type;
+    using bound = std::true_type;
+};
+
+template<bool Bound, class E, template<class...> class F, class... L>
+struct lambdaCall_ {
+    using type = E;
+    using bound = std::false_type;
+};
+
+template<class E, template<class...> class F, class... L>
+struct lambdaCall_<true, E, F, L...> {
+    using type = t_<F<t_<L>...>>;
+    using bound = std::true_type;
+};
+
+template<template<class...> class F, class... A, class... T>
+struct lambda_< void, F<A...>, T... >
+    : lambdaCall_< anyOf_<lambda_<void, A, T...>::bound::value...>::value, F<A...>, F,
+                   lambda_<void, A, T...>... >
+{};
+
+// Invoke a matcher. A metafunction class (has a nested `apply`, as all matchers here do) is called
+// directly. Anything else, e.g. an MPL lambda expression with placeholders, is applied as
+// boost::mpl::apply would (see lambda_). Either way the result is the bool_constant of the
+// meta-predicate.
+template<class Void, class MetaFcn, class... T>
+struct InvokeMatcher_ {
+    using type = t_<t_<lambda_<void, MetaFcn, T...>>>;
+};
+
+template<class MetaFcn, class... T>
+struct InvokeMatcher_< t_<voider_<typename MetaFcn::template apply<T...>>>, MetaFcn, T... > {
+    using type = t_<typename MetaFcn::template apply<T...>>;
+};
+
+template<class MetaFcn, class... T>
+using InvokeMatcher = t_<InvokeMatcher_<void, MetaFcn, T...>>;
+
+
+// What a forged error shows of a failing argument T: `MetaFcn::show<T>` where the matcher has one
+// (the layout matchers show sizes and offsets that way), else T itself.
+template<class Void, class MetaFcn, class T>
+struct shown_ { using type = T; };
+
+template<class MetaFcn, class T>
+struct shown_< t_<voider_<typename MetaFcn::template show<T>>>, MetaFcn, T > {
+    using type = typename MetaFcn::template show<T>;
+};
+
+// Shown by the layout matchers: T, with its size and alignment, or with the offset of the member
+// whose offset Member<T> gives
+template< class T, std::size_t Size, std::size_t Align > struct layout_;
+template< class T, template<class> class Member, std::size_t Offset > struct offset_;
+
+// Shown by the value matchers: T, with its value
+template< class T, class V, V Value > struct value_;
+
+// Shown by the string matchers: T, with the offset in its text where matching stopped
+template< class T, std::size_t Offset > struct mismatch_;
+
+
 // Similarly, get dependent-context independent sentinel type in forged error
 template< class NullMF >
 using extractForgedErrorSentinel = typename NullMF::ST_STATIC_EXPECT_CONFIG_FORGED_ERROR_SENTINEL;
 
 
+// Type summary, shown in forged errors instead of the full type in the reduced-diagnostic mode
+// (ST_STATIC_EXPECT_CONFIG_TYPE_SUMMARY). `summarize<T, Depth, Width>::type` is T where class
+// templates below Depth levels have their arguments elided, and each keeps its first Width
+// arguments only. A template with elided arguments is shown as `tpl_<Tmpl, args..., more_<N>>`;
+// one shown in full is rebuilt as itself, so that small types read as usual.
+template< template<class...> class Tmpl, class... Args > struct tpl_;
+template< std::size_t N > struct more_;
+
+template< class T > struct type_ { using type = T; };
+template< class... T > struct list_ { static constexpr std::size_t size = sizeof...(T); };
+
+template< class T, int Depth, int Width > struct summarize;
+
+// Summarize the first Keep arguments, collecting into Out
+template< int Keep, int Depth, int Width, class Out, class... In >
+struct summarizeArgs_;
+
+template< int Keep, int Depth, int Width, class... Out >
+struct summarizeArgs_< Keep, Depth, Width, list_<Out...> > {
+    static constexpr bool elided = false;
+    using type = list_<Out...>;
+};
+
+template< int Depth, int Width, class... Out, class A, class... In >
+struct summarizeArgs_< 0, Depth, Width, list_<Out...>, A, In... > {
+    static constexpr bool elided = true;
+    using type = list_<Out..., more_<1 + sizeof...(In)>>;
+};
+
+template< int Keep, int Depth, int Width, class... Out, class A, class... In >
+struct summarizeArgs_< Keep, Depth, Width, list_<Out...>, A, In... >
+    : summarizeArgs_< Keep-1, Depth, Width, list_<Out..., t_<summarize<A, Depth, Width>>>, In... >
+{};
+
+template< template<class...> class Tmpl, bool Elided, class Args >
+struct rebuild_;
+
+template< template<class...> class Tmpl, class... Args >
+struct rebuild_< Tmpl, false, list_<Args...> > { using type = Tmpl<Args...>; };
+
+template< template<class...> class Tmpl, class... Args >
+struct rebuild_< Tmpl, true, list_<Args...> > { using type = tpl_<Tmpl, Args...>; };
+
+template< template<class...> class Tmpl, class Args >
+struct summarizeTemplate_ : rebuild_< Tmpl, Args::elided, t_<Args> > {};
+
+template< class T, int Depth, int Width >
+struct summarize { using type = T; };
+
+template< template<class...> class Tmpl, class... A, int Depth, int Width >
+struct summarize< Tmpl<A...>, Depth, Width >
+    : t_<std::conditional< (Depth > 0 || sizeof...(A) == 0),
+        summarizeTemplate_< Tmpl, summarizeArgs_<Width, Depth-1, Width, list_<>, A...> >,
+        type_< tpl_<Tmpl, more_<sizeof...(A)>> >
+    >>
+{};
+
+// Look through compound types
+template< class T, int D, int W > struct summarize< T*, D, W >       { using type = t_<summarize<T, D, W>>*; };
+template< class T, int D, int W > struct summarize< T&, D, W >       { using type = t_<summarize<T, D, W>>&; };
+template< class T, int D, int W > struct summarize< T&&, D, W >      { using type = t_<summarize<T, D, W>>&&; };
+template< class T, int D, int W > struct summarize< T const, D, W >  { using type = t_<summarize<T, D, W>> const; };
+
+// summarize the type of a nullary metafunction, without evaluating it until then
+template< class NullMF, int Depth, int Width >
+struct summarizeLazy_ : summarize< t_<NullMF>, Depth, Width > {};
+
+
 
 
 // Generate T0, T1, T2, .. structs, which generates some artificial error
@@ -477,6 +848,471 @@ BOOST_PP_REPEAT(ST_STATIC_EXPECT_CONFIG_NUM_MATCHER_ARGS, ST_STAMP_, ~)
 #undef ST_STAMP_
 
 
+// STATIC_FOR_ALL: a matcher checked for every combination of the types of a few lists. The
+// combinations are enumerated by one flat index, the last list varying fastest, so a grid of P
+// combinations costs P matcher invocations plus O(1) instantiations per combination; none of the
+// helpers recurse on the grid size.
+template< std::size_t... I > struct index_seq { using type = index_seq; };
+
+template< class A, class B > struct concat_seq_;
+template< std::size_t... I, std::size_t... J >
+struct concat_seq_< index_seq<I...>, index_seq<J...> > : index_seq< I..., (sizeof...(I) + J)... > {};
+
+// logarithmic depth, unlike the obvious recursion
+template< std::size_t N >
+struct make_index_seq_ : concat_seq_< t_<make_index_seq_<N/2>>, t_<make_index_seq_<N - N/2>> > {};
+template<> struct make_index_seq_<0> : index_seq<> {};
+template<> struct make_index_seq_<1> : index_seq<0> {};
+
+template< std::size_t N >
+using make_index_seq = t_<make_index_seq_<N>>;
+
+// Element I of a list_ by overload resolution against a base class, in O(1) instantiations
+template< std::size_t I, class T > struct indexed_ { using type = T; };
+
+template< class Is, class List > struct indexer_;
+template< std::size_t... I, class... T >
+struct indexer_< index_seq<I...>, list_<T...> > : indexed_<I, T>... {};
+
+template< std::size_t I, class T > indexed_<I, T> select_( indexed_<I, T> const* );
+
+template< std::size_t I, class List >
+using type_at_ = t_<decltype( select_<I>( static_cast<indexer_<make_index_seq<List::size>, List>*>(nullptr) ) )>;
+
+constexpr std::size_t product_() { return 1; }
+template< class... N >
+constexpr std::size_t product_( std::size_t n, N... ns ) { return n * product_(ns...); }
+
+// Digit J of the flat index K in the mixed radix of the list sizes
+constexpr std::size_t digit_( std::size_t, std::size_t ) { return 0; }
+template< class... N >
+constexpr std::size_t digit_( std::size_t k, std::size_t j, std::size_t n, N... ns ) {
+    return j == 0 ? (k / product_(ns...)) % n : digit_(k, j-1, ns...);
+}
+
+// Position of the first false in b[lo, hi), or hi. Divide and conquer keeps the constexpr
+// recursion depth logarithmic (C++11 has no loops).
+constexpr std::size_t firstFalse_( bool const* b, std::size_t lo, std::size_t hi );
+constexpr std::size_t firstFalseRight_( std::size_t left, bool const* b, std::size_t mid, std::size_t hi ) {
+    return left != mid ? left : firstFalse_(b, mid, hi);
+}
+constexpr std::size_t firstFalse_( bool const* b, std::size_t lo, std::size_t hi ) {
+    return hi - lo == 0 ? hi
+         : hi - lo == 1 ? (b[lo] ? hi : lo)
+         : firstFalseRight_( firstFalse_(b, lo, lo + (hi-lo)/2), b, lo + (hi-lo)/2, hi );
+}
+
+// A combination with its Transform elements applied to the types before them, as list_<Done...>;
+// Last is the type the next Transform applies to
+template< class Done, class Last, class... In > struct fold_;
+
+template< class... Done, class Last >
+struct fold_< list_<Done...>, Last > { using type = list_<Done..., Last>; };
+
+template< class... Done, class Last, class A, class... In >
+struct fold_< list_<Done...>, Last, A, In... > : fold_< list_<Done..., Last>, A, In... > {};
+
+template< class... Done, class Last, template<class...> class F, class... In >
+struct fold_< list_<Done...>, Last, static_matchers_impl::Transform<F>, In... >
+    : fold_< list_<Done...>, t_<F<Last>>, In... > {};
+
+template< class MetaFcn, class List > struct invokeList_;
+template< class MetaFcn, class... T >
+struct invokeList_< MetaFcn, list_<T...> > : InvokeMatcher< MetaFcn, T... > {};
+
+// The matcher, applied to the folded combination
+template< class MetaFcn >
+struct folding_ {
+    template< class... T >
+    using apply = invokeList_< MetaFcn, t_<fold_<list_<>, T...>> >;
+};
+
+// Grids without transforms, the usual case, skip the folding
+template< class T > struct isTransform_ : std::false_type {};
+template< template<class...> class F >
+struct isTransform_< static_matchers_impl::Transform<F> > : std::true_type {};
+
+template< class List > struct hasTransform_;
+template< class... T >
+struct hasTransform_< list_<T...> > : anyOf_< isTransform_<T>::value... > {};
+
+template< class... Lists >
+using hasTransforms_ = anyOf_< hasTransform_<Lists>::value... >;
+
+template< class MetaFcn, class K, class J, class... Lists >
+struct ForAll_;
+
+template< class MetaFcn, std::size_t... K, std::size_t... J, class... Lists >
+struct ForAll_< MetaFcn, index_seq<K...>, index_seq<J...>, Lists... > {
+    template< std::size_t k >
+    struct check_ : InvokeMatcher< MetaFcn, type_at_<digit_(k, J, Lists::size...), Lists>... > {};
+
+    // leading `true` keeps the array non-empty
+    static constexpr bool results_[] = { true, check_<K>::value... };
+
+    static constexpr bool value =
+        std::is_same< bools_<true, check_<K>::value...>, bools_<check_<K>::value..., true> >::value;
+
+    // Argument I of the first combination that fails
+    template< std::size_t I >
+    using failing = type_at_< digit_(firstFalse_(results_, 1, sizeof...(K) + 1) - 1, I, Lists::size...),
+                              type_at_<I, list_<Lists...>> >;
+};
+
+template< class MetaFcn, std::size_t... K, std::size_t... J, class... Lists >
+constexpr bool ForAll_< MetaFcn, index_seq<K...>, index_seq<J...>, Lists... >::results_[];
+
+template< class MetaFcn, class... Lists >
+using ForAll = ForAll_< t_<std::conditional< hasTransforms_<Lists...>::value, folding_<MetaFcn>, MetaFcn >>,
+                        make_index_seq<product_(Lists::size...)>,
+                        make_index_seq<sizeof...(Lists)>, Lists... >;
+
+// Nullary metafunction for argument I of the first failing combination
+template< class R, std::size_t I >
+struct forAllFailing_ { using type = typename R::template failing<I>; };
+
+
+//===-  [Strings]  -===//
+// Constant evaluation of the string matchers. The scans are loops where constexpr allows them. In
+// C++11 constexpr a loop is a recursion, and the default depth limit (512) is far below the length
+// of the strings to check; so there, like firstFalse_ above, the scans split their range in halves,
+// left first, down to blocks of 8 characters: the depth grows with log2 of the length, and the
+// steps, linearly. Lengths of 64K take ~13 levels.
+//
+// Either way, a text is a type, text_<T> for the string T::value, and the scans take offsets into
+// it only: GCC hashes the arguments of constant calls to memoize them, and a pointer into a string
+// literal by all of the literal, which would make every call that took one linear in its length.
+
+constexpr std::size_t npos_ = std::size_t(-1);
+
+// Contains searches the text in one pass, as the Knuth-Morris-Pratt algorithm does: its state is
+// how many characters of the operand B match up to the current place, and on a mismatch it falls
+// back to the border of those, the longest proper prefix of B that is also a suffix of them. The
+// borders are templates, worked out once per operand; the search then takes a step per character,
+// and falls back at most as many times as it stepped.
+template< class B, std::size_t Q > struct border_;
+
+// The state after the K characters of B that match are followed by C
+template< class B, std::size_t K, char C, bool = B::data()[K] == C, bool = K == 0 >
+struct extend_ : std::integral_constant< std::size_t, K + 1 > {};
+template< class B, std::size_t K, char C >
+struct extend_< B, K, C, false, true > : std::integral_constant< std::size_t, 0 > {};
+template< class B, std::size_t K, char C >
+struct extend_< B, K, C, false, false > : extend_< B, border_<B, K>::value, C > {};
+
+template< class B, std::size_t Q >
+struct border_ : extend_< B, border_<B, Q - 1>::value, B::data()[Q - 1] > {};
+template< class B >
+struct border_< B, 1 > : std::integral_constant< std::size_t, 0 > {};
+template< class B >
+struct border_< B, 0 > : std::integral_constant< std::size_t, 0 > {};
+
+template< class B, class I = make_index_seq<B::size() + 1> > struct borders_;
+template< class B, std::size_t... I >
+struct borders_< B, index_seq<I...> > {
+    static constexpr std::size_t value[] = { border_<B, I>::value... };
+};
+template< class B, std::size_t... I >
+constexpr std::size_t borders_< B, index_seq<I...> >::value[];
+
+// The state after the k characters of B that match are followed by c
+template< class B >
+constexpr std::size_t step_( std::size_t k, char c ) {
+    return B::data()[k] == c ? k + 1 : k == 0 ? 0 : step_<B>(borders_<B>::value[k], c);
+}
+
+#if ST_CONFIG_HAS_RELAXED_CONSTEXPR
+
+// First null in [i, i+n) of A
+template< class A >
+constexpr std::size_t null_( std::size_t i, std::size_t n ) {
+    char const* s = A::data();
+    for (; n != 0; ++i, --n)
+        if (s[i] == '\0')
+            return i;
+    return npos_;
+}
+
+// Length of the null terminated A
+template< class A >
+constexpr std::size_t length_() {
+    char const* s = A::data();
+    std::size_t n = 0;
+    while (s[n] != '\0')
+        ++n;
+    return n;
+}
+
+// First i in [i, i+n) where A at a + i differs from B at i
+template< class A, class B >
+constexpr std::size_t diff_( std::size_t a, std::size_t i, std::size_t n ) {
+    char const* s = A::data() + a;
+    char const* t = B::data();
+    for (; n != 0; ++i, --n)
+        if (s[i] != t[i])
+            return i;
+    return npos_;
+}
+
+// The state of the search for B after A[i, i+n), from state q (see contains_)
+template< class A, class B >
+constexpr std::size_t scan_( std::size_t m, std::size_t q, std::size_t i, std::size_t n ) {
+    char const* s = A::data();
+    for (; n != 0 && q != m; ++i, --n)
+        q = step_<B>(q, s[i]);
+    return q;
+}
+
+#else
+
+// First null in [i, i+n) of A; never reads past it
+template< class A >
+constexpr std::size_t null_( std::size_t i, std::size_t n );
+template< class A >
+constexpr std::size_t nullRight_( std::size_t left, std::size_t i, std::size_t n ) {
+    return left != npos_ ? left : null_<A>(i, n);
+}
+template< class A >
+constexpr std::size_t null_( std::size_t i, std::size_t n ) {
+    return n > 8 ? nullRight_<A>( null_<A>(i, n/2), i + n/2, n - n/2 )
+         : n > 0 && A::data()[i]     == '\0' ? i
+         : n > 1 && A::data()[i + 1] == '\0' ? i + 1
+         : n > 2 && A::data()[i + 2] == '\0' ? i + 2
+         : n > 3 && A::data()[i + 3] == '\0' ? i + 3
+         : n > 4 && A::data()[i + 4] == '\0' ? i + 4
+         : n > 5 && A::data()[i + 5] == '\0' ? i + 5
+         : n > 6 && A::data()[i + 6] == '\0' ? i + 6
+         : n > 7 && A::data()[i + 7] == '\0' ? i + 7
+         : npos_;
+}
+
+// Length of the null terminated A: blocks of doubling size, from [i, i+n) on
+template< class A >
+constexpr std::size_t length_( std::size_t i = 0, std::size_t n = 16 );
+template< class A >
+constexpr std::size_t lengthRight_( std::size_t found, std::size_t i, std::size_t n ) {
+    return found != npos_ ? found : length_<A>(i, n);
+}
+template< class A >
+constexpr std::size_t length_( std::size_t i, std::size_t n ) {
+    return lengthRight_<A>( null_<A>(i, n), i + n, 2*n );
+}
+
+// First i in [i, i+n) where A at a + i differs from B at i
+template< class A, class B >
+constexpr std::size_t diff_( std::size_t a, std::size_t i, std::size_t n );
+template< class A, class B >
+constexpr std::size_t diffRight_( std::size_t left, std::size_t a, std::size_t i, std::size_t n ) {
+    return left != npos_ ? left : diff_<A, B>(a, i, n);
+}
+template< class A, class B >
+constexpr std::size_t diff_( std::size_t a, std::size_t i, std::size_t n ) {
+    return n > 8 ? diffRight_<A, B>( diff_<A, B>(a, i, n/2), a, i + n/2, n - n/2 )
+         : n > 0 && A::data()[a + i]     != B::data()[i]     ? i
+         : n > 1 && A::data()[a + i + 1] != B::data()[i + 1] ? i + 1
+         : n > 2 && A::data()[a + i + 2] != B::data()[i + 2] ? i + 2
+         : n > 3 && A::data()[a + i + 3] != B::data()[i + 3] ? i + 3
+         : n > 4 && A::data()[a + i + 4] != B::data()[i + 4] ? i + 4
+         : n > 5 && A::data()[a + i + 5] != B::data()[i + 5] ? i + 5
+         : n > 6 && A::data()[a + i + 6] != B::data()[i + 6] ? i + 6
+         : n > 7 && A::data()[a + i + 7] != B::data()[i + 7] ? i + 7
+         : npos_;
+}
+
+// The state of the search for B after A[i, i+n), from state q (see contains_); once it is m, it
+// stays so
+template< class A, class B >
+constexpr std::size_t scan_( std::size_t m, std::size_t q, std::size_t i, std::size_t n ) {
+    return q == m || n == 0 ? q
+         : n > 8 ? scan_<A, B>( m, scan_<A, B>(m, q, i, n/2), i + n/2, n - n/2 )
+         : scan_<A, B>( m, step_<B>(q, A::data()[i]), i + 1, n - 1 );
+}
+
+#endif
+
+// The text of T::value: a `char const*`, a char array, or anything with data() and size()
+// (std::string_view, fixed_string..)
+template< class T, class V = t_<std::remove_cv<decltype(T::value)>> >
+struct text_ {
+    static constexpr char const* data() { return T::value.data(); }
+    static constexpr std::size_t size() { return T::value.size(); }
+};
+template< class T >
+struct text_< T, char const* > {
+    static constexpr char const* data() { return T::value; }
+    static constexpr std::size_t size() { return length_<text_>(); }
+};
+template< class T >
+struct text_< T, char* > : text_< T, char const* > {};
+template< class T, std::size_t N >
+struct text_< T, char[N] > {
+    static constexpr char const* data() { return T::value; }
+    static constexpr std::size_t size( std::size_t n ) { return n == npos_ ? N : n; }
+    static constexpr std::size_t size() { return size(null_<text_>(0, N)); }
+};
+
+// Offset in T where it stops matching S, or npos_ if it matches
+struct strEq_ {
+    static constexpr std::size_t stop( std::size_t d, std::size_t tn, std::size_t sn ) {
+        return d != npos_ ? d : tn == sn ? npos_ : (tn < sn ? tn : sn);
+    }
+    template< class T, class S >
+    static constexpr std::size_t mismatch() {
+        return stop( diff_<T, S>(0, 0, T::size() < S::size() ? T::size() : S::size()),
+                     T::size(), S::size() );
+    }
+};
+
+struct startsWith_ {
+    template< class T, class S >
+    static constexpr std::size_t mismatch() {
+        return S::size() <= T::size() ? diff_<T, S>(0, 0, S::size()) : strEq_::mismatch<T, S>();
+    }
+};
+
+struct endsWith_ {
+    static constexpr std::size_t at( std::size_t d, std::size_t start ) {
+        return d == npos_ ? npos_ : start + d;
+    }
+    template< class T, class S >
+    static constexpr std::size_t mismatch() {
+        return S::size() > T::size() ? 0
+             : at( diff_<T, S>(T::size() - S::size(), 0, S::size()), T::size() - S::size() );
+    }
+};
+
+// Fails at the end of T, having found S nowhere
+struct contains_ {
+    template< class T, class S >
+    static constexpr std::size_t mismatch() {
+        return scan_<T, S>(S::size(), 0, 0, T::size()) == S::size() ? npos_ : T::size();
+    }
+};
+
+// Glob patterns: `*` is any string, `?` any character, `[abc]`, `[a-z]` any of the characters,
+// `[!abc]` or `[^abc]` any other, and `\c` the character c.
+//
+// Between the stars, a pattern is segments of elements of one character each. The segment before
+// the first star must match at the start of the text and the one after the last, at the end; any
+// other is taken where it matches first, after the previous one. Matching a segment is a linear
+// recursion, so patterns are limited to a few hundred elements between stars; the text is scanned
+// as above.
+template< class T, class P >
+struct globMatch_ {
+    static constexpr char p( std::size_t k ) { return P::data()[k]; }
+
+    static constexpr bool in( char lo, char c, char hi ) {
+        return static_cast<unsigned char>(lo) <= static_cast<unsigned char>(c) &&
+               static_cast<unsigned char>(c)  <= static_cast<unsigned char>(hi);
+    }
+
+    // Characters of the class at i start at classBody(i + 1), past the negation, if any
+    static constexpr std::size_t classBody( std::size_t k ) {
+        return k < P::size() && (p(k) == '!' || p(k) == '^') ? k + 1 : k;
+    }
+    // Past the `]` of the class at i, looking from k; i + 1 (a plain `[`) when there is none. A `]`
+    // right at the start of the characters is one of them.
+    static constexpr std::size_t classEnd( std::size_t i, std::size_t k ) {
+        return k >= P::size() ? i + 1
+             : p(k) == ']' && k != classBody(i + 1) ? k + 1
+             : classEnd(i, k + 1);
+    }
+    static constexpr bool inClass( std::size_t k, std::size_t end, char c ) {
+        return k >= end ? false
+             : k + 2 < end && p(k + 1) == '-'
+                 ? in(p(k), c, p(k + 2)) || inClass(k + 3, end, c)
+                 : p(k) == c || inClass(k + 1, end, c);
+    }
+
+    // Past the element at i
+    static constexpr std::size_t element( std::size_t i ) {
+        return p(i) == '\\' && i + 1 < P::size() ? i + 2
+             : p(i) == '[' ? classEnd(i, classBody(i + 1))
+             : i + 1;
+    }
+    // The element [i, e) matches c
+    static constexpr bool has( std::size_t i, std::size_t e, char c ) {
+        return p(i) == '?' ? true
+             : p(i) == '[' && e != i + 1
+                 ? inClass(classBody(i + 1), e - 1, c) != (classBody(i + 1) != i + 1)
+             : p(i) == '\\' && e == i + 2 ? p(i + 1) == c
+             : p(i) == c;
+    }
+
+    static constexpr std::size_t segmentEnd( std::size_t i ) {
+        return i == P::size() || p(i) == '*' ? i : segmentEnd(element(i));
+    }
+    static constexpr std::size_t segmentSize( std::size_t i, std::size_t e ) {
+        return i == e ? 0 : 1 + segmentSize(element(i), e);
+    }
+    static constexpr std::size_t stars( std::size_t i ) {
+        return i < P::size() && p(i) == '*' ? stars(i + 1) : i;
+    }
+
+    // Where the segment [i, e) stops matching at ti, or npos_
+    static constexpr std::size_t at( std::size_t ti, std::size_t i, std::size_t e ) {
+        return i == e ? npos_
+             : ti == T::size() ? ti
+             : has(i, element(i), T::data()[ti]) ? at(ti + 1, element(i), e)
+             : ti;
+    }
+
+    // First ti in [ti, ti+n) where the segment [i, e) matches
+#if ST_CONFIG_HAS_RELAXED_CONSTEXPR
+    static constexpr std::size_t find( std::size_t i, std::size_t e, std::size_t ti, std::size_t n ) {
+        for (; n != 0; ++ti, --n)
+            if (at(ti, i, e) == npos_)
+                return ti;
+        return npos_;
+    }
+#else
+    static constexpr std::size_t findRight( std::size_t left, std::size_t i, std::size_t e,
+                                            std::size_t ti, std::size_t n ) {
+        return left != npos_ ? left : find(i, e, ti, n);
+    }
+    static constexpr std::size_t find( std::size_t i, std::size_t e, std::size_t ti, std::size_t n ) {
+        return n == 0 ? npos_
+             : n == 1 ? (at(ti, i, e) == npos_ ? ti : npos_)
+             : findRight( find(i, e, ti, n/2), i, e, ti + n/2, n - n/2 );
+    }
+#endif
+
+    // Where the text from ti stops matching the pattern from i, or npos_
+    static constexpr std::size_t match( std::size_t ti, std::size_t i ) {
+        return i == P::size() ? (ti == T::size() ? npos_ : ti)
+             : p(i) == '*' ? star(ti, stars(i))
+             : then( at(ti, i, segmentEnd(i)), ti + segmentSize(i, segmentEnd(i)), segmentEnd(i) );
+    }
+    static constexpr std::size_t then( std::size_t stop, std::size_t ti, std::size_t i ) {
+        return stop != npos_ ? stop : match(ti, i);
+    }
+    // After a star
+    static constexpr std::size_t star( std::size_t ti, std::size_t i ) {
+        return i == P::size() ? npos_
+             : segmentEnd(i) == P::size() ? last(ti, i, segmentSize(i, P::size()))
+             : next( ti, segmentEnd(i), segmentSize(i, segmentEnd(i)),
+                     T::size() - ti < segmentSize(i, segmentEnd(i)) ? npos_
+                     : find(i, segmentEnd(i), ti, T::size() - ti - segmentSize(i, segmentEnd(i)) + 1) );
+    }
+    static constexpr std::size_t last( std::size_t ti, std::size_t i, std::size_t n ) {
+        return T::size() - ti < n ? T::size() : at(T::size() - n, i, P::size());
+    }
+    static constexpr std::size_t next( std::size_t ti, std::size_t e, std::size_t n, std::size_t found ) {
+        return found == npos_ ? ti : match(found + n, e);
+    }
+};
+
+struct glob_ {
+    template< class T, class P >
+    static constexpr std::size_t mismatch() { return globMatch_<T, P>::match(0, 0); }
+};
+
+// Offset where the text of T::value stops matching that of S::value, by Op
+template< class Op, class T, class S >
+struct strMismatch_
+    : std::integral_constant< std::size_t, Op::template mismatch< text_<T>, text_<S> >() >
+{};
+
 
 } // namespace detail
 
@@ -518,19 +1354,125 @@ using AlwaysFalse = detail::Always<std::false_type>;
 using AlwaysTrue  = detail::Always<std::true_type>;
 
 
+//     +---------------+
+//     |  Combinators  |
+//     +---------------+
+//
+// Combinators compose matchers at the alias level: `apply` is an alias template straight to the
+// resulting bool_constant, so a composed matcher costs one instantiation on top of its operands,
+// however deep the nesting. The operands must be metafunction classes (every matcher here is one);
+// wrap an MPL lambda expression in boost::mpl::lambda<>::type first.
+//
+// A failing composition shows what its operands show (see st::detail::shown_): AllOf and AnyOf
+// that of the first operand which has a `show` and fails (of the first with a `show` if none
+// fails), Not that of its operand. So the sizes, values and offsets of the layout, value and string
+// matchers come through in composed form too.
+
+namespace detail {
+
+#if defined(__cpp_fold_expressions)
+template<class... B> constexpr bool all_(B... b) { return (true && ... && b); }
+template<class... B> constexpr bool any_(B... b) { return (false || ... || b); }
+#else
+constexpr bool all_() { return true; }
+template<class... B> constexpr bool all_(bool b, B... bs) { return b && all_(bs...); }
+constexpr bool any_() { return false; }
+template<class... B> constexpr bool any_(bool b, B... bs) { return b || any_(bs...); }
+#endif
+
+// I-th type of T...
+template<std::size_t I, class T, class... R> struct at_ : at_<I-1, R...> {};
+template<class T, class... R> struct at_<0, T, R...> { using type = T; };
+
+// Whether MF shows T otherwise than as is and fails on it. Only matchers with a `show` are applied
+// to T alone, and those take one argument; any others, say a Bind, might not.
+template<bool Shows, class MF, class T> struct failsShown_ : std::false_type {};
+template<class MF, class T>
+struct failsShown_<true, MF, T>
+    : std::integral_constant<bool, !st::detail::InvokeMatcher<MF, T>::value> {};
+
+template<class MF, class T>
+using shows_ = std::integral_constant<bool,
+    !std::is_same<st::detail::t_<st::detail::shown_<void, MF, T>>, T>::value>;
+
+// What the first of MF... that shows T shows, else T
+template<class T, class... MF> struct firstShowing_ { using type = T; };
+template<class T, class MF, class... R>
+struct firstShowing_<T, MF, R...>
+    : st::detail::t_<std::conditional< shows_<MF, T>::value,
+        st::detail::shown_<void, MF, T>, firstShowing_<T, R...> >>
+{};
+
+// What the first of MF... that shows T and fails on it shows; if none fails (the composition is
+// negated), what the first that shows T shows
+template<class T, class All, class... MF> struct firstFailing_;
+template<class T, class... All>
+struct firstFailing_<T, st::detail::list_<All...>> : firstShowing_<T, All...> {};
+template<class T, class... All, class MF, class... R>
+struct firstFailing_<T, st::detail::list_<All...>, MF, R...>
+    : st::detail::t_<std::conditional< failsShown_<shows_<MF, T>::value, MF, T>::value,
+        st::detail::shown_<void, MF, T>, firstFailing_<T, st::detail::list_<All...>, R...> >>
+{};
+
+template<class T, class... MF>
+using firstShown_ = firstFailing_<T, st::detail::list_<MF...>, MF...>;
+
+} // namespace detail
+
+
+// Negation of a matcher
 template<class MF>
 struct Not {
     template<class... T>
-    struct apply
-        : std::integral_constant< bool,
-           !boost::mpl::apply< MF, T...>::type::value
-        >
-    {};
+    using apply = std::integral_constant<bool, !MF::template apply<T...>::type::value>;
+
+    template<class T> using show = st::detail::t_<st::detail::shown_<void, MF, T>>;
 };
 
 template<class T>
 using IsNot = Not<Is<T>>;
 
+// Conjunction of matchers, all applied to the same arguments
+template<class... MF>
+struct AllOf {
+    template<class... T>
+    using apply = std::integral_constant<bool,
+        detail::all_(MF::template apply<T...>::type::value...)>;
+
+    template<class T> using show = st::detail::t_<detail::firstShown_<T, MF...>>;
+};
+
+// Disjunction of matchers, all applied to the same arguments
+template<class... MF>
+struct AnyOf {
+    template<class... T>
+    using apply = std::integral_constant<bool,
+        detail::any_(MF::template apply<T...>::type::value...)>;
+
+    template<class T> using show = st::detail::t_<detail::firstShown_<T, MF...>>;
+};
+
+// Apply a matcher to the arguments at positions I... only. E.g. with two arguments,
+// `AllOf< Bind<Is<int>, 0>, Bind<Is<long>, 1> >` matches `int, long`.
+template<class MF, std::size_t... I>
+struct Bind {
+    template<class... T>
+    using apply = typename MF::template apply< typename detail::at_<I, T...>::type... >;
+};
+
+// A STATIC_FOR_ALL list element which stands for `F<T>::type` of the type T drawn from the list
+// before it (see STATIC_FOR_ALL); any of the <type_traits> transformations will do for F
+template< template<class...> class F >
+struct Transform {};
+
+using AsIs        = Transform< st::detail::type_ >;
+using AddConst    = Transform< std::add_const >;
+using AddVolatile = Transform< std::add_volatile >;
+using AddCV       = Transform< std::add_cv >;
+using AddPointer  = Transform< std::add_pointer >;
+using AddLvalueReference = Transform< std::add_lvalue_reference >;
+using AddRvalueReference = Transform< std::add_rvalue_reference >;
+
 //
 // struct AreSameType {
 //     template<class...T>
@@ -553,19 +1495,468 @@ struct IsTrue {
 
 
 
-    template<int N>
-    struct Eq
+// Value matchers: applicable to any type with a static constant `value` member, i.e. integral
+// constants, or the arguments of STATIC_EXPECT_THAT_VALUE. Each compares the value with the bound(s)
+// in one instantiation, and a failure shows the value, as in
+// `Type0<st::detail::value_<std::extent<int[5]>, long unsigned int, 5>>`, composed as well, as in
+// `(AllOf<Lt<5>, Ne<4>>)` or `Not<Between<0, 9>>`.
+//
+// The bounds keep their type: `Eq_c<std::size_t, N>`, `Lt_c<char, 'z'>` and so on. The short forms
+// `Eq<N>`, `Lt<N>`.. deduce it (C++17 `auto`), or else take an int. Integers compare by value across
+// signedness, as with C++20 std::cmp_less: Lt<0> is false for any unsigned value, not true for
+// most. Anything else (enumerations, class types) compares with its own `==` and `<`.
+
+namespace detail {
+
+// 1 for a signed and an unsigned integer, -1 for the other way round, 0 if no conversion is needed
+template<class A, class B>
+struct signs_ : std::integral_constant<int,
+    (std::is_integral<A>::value && std::is_integral<B>::value &&
+     !std::is_same<A, bool>::value && !std::is_same<B, bool>::value)
+        ? int(std::is_signed<A>::value) - int(std::is_signed<B>::value) : 0>
+{};
+
+template<int Signs> struct compare_;
+
+template<> struct compare_<0> {
+    template<class A, class B> static constexpr bool eq(A a, B b) { return a == b; }
+    template<class A, class B> static constexpr bool lt(A a, B b) { return a < b; }
+};
+
+template<> struct compare_<1> {
+    template<class A, class B> static constexpr bool eq(A a, B b) {
+        return !(a < 0) && static_cast<typename std::make_unsigned<A>::type>(a) == b;
+    }
+    template<class A, class B> static constexpr bool lt(A a, B b) {
+        return a < 0 || static_cast<typename std::make_unsigned<A>::type>(a) < b;
+    }
+};
+
+template<> struct compare_<-1> {
+    template<class A, class B> static constexpr bool eq(A a, B b) {
+        return !(b < 0) && a == static_cast<typename std::make_unsigned<B>::type>(b);
+    }
+    template<class A, class B> static constexpr bool lt(A a, B b) {
+        return !(b < 0) && a < static_cast<typename std::make_unsigned<B>::type>(b);
+    }
+};
+
+template<class A, class B>
+constexpr bool equal_(A a, B b) { return compare_<signs_<A, B>::value>::eq(a, b); }
+
+template<class A, class B>
+constexpr bool less_(A a, B b) { return compare_<signs_<A, B>::value>::lt(a, b); }
+
+template<class T>
+using valueOf_ = st::detail::value_< T, st::detail::t_<std::decay<decltype(T::value)>>, T::value >;
+
+} // namespace detail
+
+    template<class V, V N>
+    struct Eq_c
+    {
+        template<class T>
+        struct apply : std::integral_constant<bool, detail::equal_(T::value, N)>
+        {};
+
+        template<class T> using show = detail::valueOf_<T>;
+    };
+
+    template<class V, V N>
+    struct Ne_c
     {
         template<class T>
-        struct apply : std::integral_constant<bool, static_cast<int>(T::value) == N>
+        struct apply : std::integral_constant<bool, !detail::equal_(T::value, N)>
         {};
+
+        template<class T> using show = detail::valueOf_<T>;
+    };
+
+    template<class V, V N>
+    struct Lt_c
+    {
+        template<class T>
+        struct apply : std::integral_constant<bool, detail::less_(T::value, N)>
+        {};
+
+        template<class T> using show = detail::valueOf_<T>;
+    };
+
+    template<class V, V N>
+    struct Le_c
+    {
+        template<class T>
+        struct apply : std::integral_constant<bool, !detail::less_(N, T::value)>
+        {};
+
+        template<class T> using show = detail::valueOf_<T>;
+    };
+
+    template<class V, V N>
+    struct Gt_c
+    {
+        template<class T>
+        struct apply : std::integral_constant<bool, detail::less_(N, T::value)>
+        {};
+
+        template<class T> using show = detail::valueOf_<T>;
+    };
+
+    template<class V, V N>
+    struct Ge_c
+    {
+        template<class T>
+        struct apply : std::integral_constant<bool, !detail::less_(T::value, N)>
+        {};
+
+        template<class T> using show = detail::valueOf_<T>;
+    };
+
+    // Closed range [Lo, Hi]
+    template<class V, V Lo, V Hi>
+    struct Between_c
+    {
+        template<class T>
+        struct apply : std::integral_constant<bool,
+            !detail::less_(T::value, Lo) && !detail::less_(Hi, T::value)>
+        {};
+
+        template<class T> using show = detail::valueOf_<T>;
+    };
+
+#if ST_CONFIG_HAS_AUTO_NTTP
+    template<auto N> using Eq = Eq_c<decltype(N), N>;
+    template<auto N> using Ne = Ne_c<decltype(N), N>;
+    template<auto N> using Lt = Lt_c<decltype(N), N>;
+    template<auto N> using Le = Le_c<decltype(N), N>;
+    template<auto N> using Gt = Gt_c<decltype(N), N>;
+    template<auto N> using Ge = Ge_c<decltype(N), N>;
+    template<auto Lo, decltype(Lo) Hi> using Between = Between_c<decltype(Lo), Lo, Hi>;
+#else
+    template<int N> using Eq = Eq_c<int, N>;
+    template<int N> using Ne = Ne_c<int, N>;
+    template<int N> using Lt = Lt_c<int, N>;
+    template<int N> using Le = Le_c<int, N>;
+    template<int N> using Gt = Gt_c<int, N>;
+    template<int N> using Ge = Ge_c<int, N>;
+    template<int Lo, int Hi> using Between = Between_c<int, Lo, Hi>;
+#endif
+
+    // Former name of Between
+#if ST_CONFIG_HAS_AUTO_NTTP
+    template<auto Lo, decltype(Lo) Hi> using InRange = Between<Lo, Hi>;
+#else
+    template<int Lo, int Hi> using InRange = Between<Lo, Hi>;
+#endif
+
+
+//     +-------------------------+
+//     |  Interface conformance  |
+//     +-------------------------+
+//
+// Matchers for what a CRTP base or a policy-based class expects of its policy. A member is named by
+// a detector, an alias template that is well-formed only when T has the member:
+//
+//    template<class T> using run_ = decltype(&T::run);
+//
+//    STATIC_EXPECT_THAT( FastPolicy, (HasSignature<run_, void(int) const noexcept>) );
+//
+// ConformsTo checks a named bundle of them, the interface, in a single instantiation:
+//
+//    struct ZeroOverhead
+//        : Requirements< HasSignature<run_, void(int) const>, IsNoexcept<run_>,
+//                        IsTriviallyCopyable, SizeIs<8>, AlignmentIs<8> > {};
+//
+//    STATIC_EXPECT_THAT( FastPolicy, ConformsTo<ZeroOverhead> );
+
+namespace detail {
+
+// Op<T>, or void_ if that is ill-formed
+template<class Void, template<class> class Op, class T>
+struct detected_ { using type = st::detail::void_; };
+
+template<template<class> class Op, class T>
+struct detected_< st::detail::t_<st::detail::voider_<Op<T>>>, Op, T > { using type = Op<T>; };
+
+template<template<class> class Op, class T>
+using detected = st::detail::t_<detected_<void, Op, T>>;
+
+// Whether a detected member is noexcept: a bool_constant as is, a function type (through a
+// pointer or pointer to member) if its exception specification is part of the type. `function` is
+// the type less the exception specification.
+template<class P> struct noexcept_ : std::false_type { using function = P; };
+template<bool B> struct noexcept_< std::integral_constant<bool, B> > : std::integral_constant<bool, B> {
+    using function = std::integral_constant<bool, B>;
+};
+template<class R, class C> struct noexcept_< R C::* > : noexcept_<R> {};
+template<class F> struct noexcept_< F* > : noexcept_<F> {};
+
+#if ST_CONFIG_HAS_NOEXCEPT_FUNCTION_TYPE
+#define ST_STAMP_(cvref)                                                                    \
+    template<class R, class... A> struct noexcept_< R(A...) cvref noexcept > : std::true_type { \
+        using function = R(A...) cvref;                                                     \
     };
+ST_STAMP_()          ST_STAMP_(&)                ST_STAMP_(&&)
+ST_STAMP_(const)     ST_STAMP_(const &)          ST_STAMP_(const &&)
+ST_STAMP_(volatile)  ST_STAMP_(volatile &)       ST_STAMP_(volatile &&)
+ST_STAMP_(const volatile) ST_STAMP_(const volatile &) ST_STAMP_(const volatile &&)
+#undef ST_STAMP_
+#endif
+
+template<class F>
+using withoutNoexcept_ = typename noexcept_<F>::function;
+
+// The type of a member with the class stripped: `R(A...) const` for `R (C::*)(A...) const`, `R`
+// for a data member `R C::*`, `R(A...)` for a static member function. Less any noexcept, which is
+// for IsNoexcept to check.
+template<class P> struct signature_ { using type = P; };
+template<class R, class C> struct signature_< R C::* > { using type = withoutNoexcept_<R>; };
+template<class F> struct signature_< F* >
+    : std::conditional< std::is_function<F>::value, withoutNoexcept_<F>, F* > {};
+
+} // namespace detail
+
+// The apply of these takes exactly one argument, so it is a class rather than an alias template: a
+// pack expansion (as in AllOf) can't be the argument of an alias template's non-pack parameter.
+
+// T has the member detected by Op
+template<template<class> class Op>
+struct HasMember {
+    template<class T>
+    struct apply : std::integral_constant<bool,
+        !std::is_same< detail::detected<Op, T>, st::detail::void_ >::value>
+    {};
+};
+
+// T has the member detected by Op, of exactly the type Sig, as given by `decltype(&T::member)`
+// with the class stripped: e.g. `void(int) const` for a const member function, `int` for a data
+// member. A noexcept is ignored on either side, so that the same Sig works before and after C++17.
+template<template<class> class Op, class Sig>
+struct HasSignature {
+    template<class T>
+    struct apply : std::is_same< detail::withoutNoexcept_<Sig>,
+                                 st::detail::t_<detail::signature_<detail::detected<Op, T>>> >
+    {};
+};
+
+// The member detected by Op is noexcept. The detector yields either a pointer to the member
+// (C++17 and up, where noexcept is part of the function type), or a bool_constant of a noexcept
+// expression, which works in C++11 as well:
+//
+//    template<class T> using run_nothrow_ =
+//        std::integral_constant<bool, noexcept(std::declval<T const&>().run(0))>;
+template<template<class> class Op>
+struct IsNoexcept {
+    template<class T>
+    struct apply : std::integral_constant<bool, detail::noexcept_< detail::detected<Op, T> >::value>
+    {};
+};
+
+struct IsTriviallyCopyable {
+    template<class T>
+    struct apply : std::is_trivially_copyable<T>
+    {};
+};
+
+// An interface: the matchers a conforming type satisfies, checked all at once. Derive from it to
+// give it a name.
+template<class... MF>
+struct Requirements : AllOf<MF...> {};
+
+// T satisfies all the requirements of Interface
+template<class Interface>
+struct ConformsTo {
+    template<class T>
+    struct apply : Interface::template apply<T>
+    {};
+
+    template<class T> using show = st::detail::t_<st::detail::shown_<void, Interface, T>>;
+};
+
+
+//     +----------+
+//     |  Layout  |
+//     +----------+
+//
+// Size, alignment and member offsets of hot data structures. On failure the forged error shows the
+// numbers along with the type, e.g. `Type0<st::detail::layout_<Node, 72, 8>>` for a Node of size 72
+// and alignment 8, also through AllOf, AnyOf, Not and ConformsTo (the first failing operand's).
+// Member offsets are given by an alias template, as members are by detectors:
+//
+//    template<class T> using next_at_ = std::integral_constant<std::size_t, offsetof(T, next)>;
+//
+//    STATIC_EXPECT_THAT( Node, (AllOf< FitsInCacheLine, NoPadding, OffsetOf<next_at_, 0> >) );
+
+namespace detail {
+
+template<class T>
+using layoutOf_ = st::detail::layout_< T, sizeof(T), alignof(T) >;
+
+} // namespace detail
+
+template<std::size_t N>
+struct SizeIs {
+    template<class T>
+    struct apply : std::integral_constant<bool, sizeof(T) == N>
+    {};
+
+    template<class T> using show = detail::layoutOf_<T>;
+};
+
+// Alignment of exactly N
+template<std::size_t N>
+struct AlignmentIs {
+    template<class T>
+    struct apply : std::integral_constant<bool, alignof(T) == N>
+    {};
+
+    template<class T> using show = detail::layoutOf_<T>;
+};
+
+// Alignment of (a multiple of) N, e.g. AlignedTo<64> to keep neighbours off T's cache lines
+template<std::size_t N>
+struct AlignedTo {
+    template<class T>
+    struct apply : std::integral_constant<bool, alignof(T) % N == 0>
+    {};
+
+    template<class T> using show = detail::layoutOf_<T>;
+};
+
+// Size of at most ST_STATIC_EXPECT_CONFIG_CACHE_LINE_SIZE
+struct FitsInCacheLine {
+    template<class T>
+    struct apply : std::integral_constant<bool, sizeof(T) <= ST_STATIC_EXPECT_CONFIG_CACHE_LINE_SIZE>
+    {};
+
+    template<class T> using show = detail::layoutOf_<T>;
+};
+
+#if ST_CONFIG_HAS_UNIQUE_OBJECT_REPRESENTATIONS
+// No padding bits: equal values of T have the same bytes. Note that, by the same token, a type with
+// floating point members doesn't match.
+struct NoPadding {
+    template<class T>
+    struct apply : std::integral_constant<bool, __has_unique_object_representations(T)>
+    {};
+
+    template<class T> using show = detail::layoutOf_<T>;
+};
+#endif
+
+// The member whose offset Member<T>::value gives is at offset N
+template<template<class> class Member, std::size_t N>
+struct OffsetOf {
+    template<class T>
+    struct apply : std::integral_constant<bool, Member<T>::value == N>
+    {};
+
+    template<class T> using show = st::detail::offset_< T, Member, Member<T>::value >;
+};
+
+
+//     +-----------+
+//     |  Strings  |
+//     +-----------+
+//
+// Text generated at compile time: SQL, format strings, symbol names.. Both the checked argument and
+// the matcher's operand are types whose static constant `value` is the string: a `char const*`, a
+// char array, or anything with constexpr data() and size(), such as std::string_view. With C++20 a
+// literal operand can be written in place, as string_c<"...">:
+//
+//    struct Query { static constexpr char const* value = makeQuery(); };
+//    struct Prefix { static constexpr char const* value = "SELECT "; };
+//
+//    STATIC_EXPECT_THAT( Query, StartsWith<Prefix> );
+//    STATIC_EXPECT_THAT( Query, Glob<string_c<"SELECT * FROM [a-z]*;">> );
+//
+// Each is one constant evaluation, which stays within the default constexpr limits for texts of 64K,
+// in C++11 as in later standards: a second or less per check, with GCC 12. StrEq, StartsWith,
+// EndsWith and Contains take steps linear in the length of the text; the operand of Contains can be
+// up to about 400 characters long, and so can the segments of a Glob pattern between stars. Glob
+// tries a segment at every place of the text until it matches, which at worst takes the product of
+// the two lengths in steps; the default limits allow about 2^18 of those, e.g. a 1K text and a 256
+// character segment. On failure the forged error shows where in the text matching stopped, e.g.
+// `Type0<st::detail::mismatch_<Query, 7>>`: the first character that differs, or for Contains, the
+// end of the text.
+
+namespace detail {
+
+template< class Op, class S >
+struct StrMatcher_ {
+    template<class T>
+    struct apply
+        : std::integral_constant<bool, st::detail::strMismatch_<Op, T, S>::value == st::detail::npos_>
+    {};
+
+    template<class T>
+    using show = st::detail::mismatch_< T, st::detail::strMismatch_<Op, T, S>::value >;
+};
+
+} // namespace detail
+
+template<class S> struct StrEq      : detail::StrMatcher_< st::detail::strEq_, S > {};
+template<class S> struct StartsWith : detail::StrMatcher_< st::detail::startsWith_, S > {};
+template<class S> struct EndsWith   : detail::StrMatcher_< st::detail::endsWith_, S > {};
+template<class S> struct Contains   : detail::StrMatcher_< st::detail::contains_, S > {};
+
+// All of the text matches the glob pattern S: `*`, `?`, `[a-z]`, `[!a-z]` and `\` escapes
+template<class S> struct Glob       : detail::StrMatcher_< st::detail::glob_, S > {};
 
 } // namespace static_matchers_impl
 
 namespace static_matchers {
     using static_matchers_impl::Is;
+    using static_matchers_impl::IsNot;
+    using static_matchers_impl::Not;
+    using static_matchers_impl::AllOf;
+    using static_matchers_impl::AnyOf;
+    using static_matchers_impl::Bind;
+    using static_matchers_impl::Transform;
+    using static_matchers_impl::AsIs;
+    using static_matchers_impl::AddConst;
+    using static_matchers_impl::AddVolatile;
+    using static_matchers_impl::AddCV;
+    using static_matchers_impl::AddPointer;
+    using static_matchers_impl::AddLvalueReference;
+    using static_matchers_impl::AddRvalueReference;
     using static_matchers_impl::Eq;
+    using static_matchers_impl::Ne;
+    using static_matchers_impl::Lt;
+    using static_matchers_impl::Le;
+    using static_matchers_impl::Gt;
+    using static_matchers_impl::Ge;
+    using static_matchers_impl::Between;
+    using static_matchers_impl::InRange;
+    using static_matchers_impl::Eq_c;
+    using static_matchers_impl::Ne_c;
+    using static_matchers_impl::Lt_c;
+    using static_matchers_impl::Le_c;
+    using static_matchers_impl::Gt_c;
+    using static_matchers_impl::Ge_c;
+    using static_matchers_impl::Between_c;
+    using static_matchers_impl::HasMember;
+    using static_matchers_impl::HasSignature;
+    using static_matchers_impl::IsNoexcept;
+    using static_matchers_impl::SizeIs;
+    using static_matchers_impl::AlignmentIs;
+    using static_matchers_impl::IsTriviallyCopyable;
+    using static_matchers_impl::AlignedTo;
+    using static_matchers_impl::FitsInCacheLine;
+#if ST_CONFIG_HAS_UNIQUE_OBJECT_REPRESENTATIONS
+    using static_matchers_impl::NoPadding;
+#endif
+    using static_matchers_impl::OffsetOf;
+    using static_matchers_impl::Requirements;
+    using static_matchers_impl::ConformsTo;
+    using static_matchers_impl::StrEq;
+    using static_matchers_impl::StartsWith;
+    using static_matchers_impl::EndsWith;
+    using static_matchers_impl::Contains;
+    using static_matchers_impl::Glob;
+#if ST_CONFIG_HAS_CLASS_NTTP
+    using st::detail::string_c;
+#endif
 }
 
 
@@ -0,0 +1,22 @@
+#  @copyright S. Levent Yilmaz 2016
+#  Distributed under the Boost Software License, Version 1.0.
+#  See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt.
+#
+# Compile SOURCE, which includes the single header, with COMPILER and FLAGS (separated by |) and
+# nothing but the directory of the single header on the include path, and check that no Boost
+# header is opened: the single header has to be self-contained.
+#
+#    cmake -DCOMPILER=.. -DFLAGS=.. -DINCLUDE=.. -DSOURCE=.. -P check.cmake
+
+string( REPLACE "|" ";" flags "${FLAGS}" )
+execute_process( COMMAND ${COMPILER} ${flags} -I${INCLUDE} -H -fsyntax-only ${SOURCE}
+                 RESULT_VARIABLE rc OUTPUT_VARIABLE out ERROR_VARIABLE out )
+if(NOT rc EQUAL 0)
+  message( FATAL_ERROR "${SOURCE} failed to compile against the single header:\n${out}" )
+endif()
+
+string( REGEX MATCHALL "[^\n]*/boost/[^\n]*" opened "${out}" )
+if(opened)
+  string( REPLACE ";" "\n" opened "${opened}" )
+  message( FATAL_ERROR "the single header opens Boost headers:\n${opened}" )
+endif()
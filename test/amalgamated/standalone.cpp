@@ -0,0 +1,43 @@
+// Uses the single header with no Boost on the include path (see check.cmake)
+
+#include <static_test.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+using namespace st::static_matchers;
+
+namespace {
+
+struct IsConvertible {
+    template<class From, class To> struct apply : std::is_convertible<From, To> {};
+};
+
+struct Packed {
+    int key;
+    int value;
+};
+
+template<class T> struct Rank {
+    ST_COVERAGE_POINT( Rank<T> );
+    static constexpr int value = 0;
+};
+
+struct Prefix { static constexpr char const* value = "SELECT "; };
+struct Query  { static constexpr char const* value = "SELECT 1;"; };
+
+ST_DEFINE_MATCHER( IsPacked, (AllOf<SizeIs<2 * sizeof(int)>, NoPadding>) );
+
+} // namespace
+
+STATIC_EXPECT_THAT( int, Is<int> );
+STATIC_EXPECT_THAT( (std::pair<int, long>), Not<Is<int>> );
+STATIC_EXPECT_THAT( Packed, IsPacked );
+STATIC_EXPECT_THAT( (std::integral_constant<int, Rank<int>::value>), (AllOf<Ge<0>, Lt<1>>) );
+STATIC_EXPECT_THAT( Query, (AllOf<StartsWith<Prefix>, Contains<Prefix>>) );
+STATIC_FOR_ALL( (short, int, long), (AsIs, AddConst), (long long, double), IsConvertible );
+
+int main() {
+    return RUNTIME_EXPECT_THAT( int, Is<int> ) ? 0 : 1;
+}
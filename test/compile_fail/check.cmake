@@ -0,0 +1,56 @@
+#  @copyright S. Levent Yilmaz 2016
+#  Distributed under the Boost Software License, Version 1.0.
+#  See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt.
+#
+# Compile SOURCE with COMPILER and FLAGS (separated by |), which has to fail, and check the
+# diagnostics against the `// expect <N>: <text>` lines of the source: <text> has to occur exactly
+# N times in the compiler output. With FILTER, a command (separated by |) that reads the output from
+# the file named last, the lines are checked against what it prints instead.
+#
+#    cmake -DCOMPILER=.. -DFLAGS=.. -DSOURCE=.. [-DFILTER=..] -P check.cmake
+
+string( REPLACE "|" ";" flags "${FLAGS}" )
+execute_process( COMMAND ${COMPILER} ${flags} -fsyntax-only -fno-diagnostics-show-caret ${SOURCE}
+                 RESULT_VARIABLE rc OUTPUT_VARIABLE out ERROR_VARIABLE out )
+if(rc EQUAL 0)
+  message( FATAL_ERROR "${SOURCE} compiled, but has to fail" )
+endif()
+
+if(FILTER)
+  get_filename_component( name ${SOURCE} NAME_WE )
+  file( WRITE ${name}.log "${out}" )
+  string( REPLACE "|" ";" filter "${FILTER}" )
+  execute_process( COMMAND ${filter} ${name}.log RESULT_VARIABLE rc OUTPUT_VARIABLE out )
+  if(NOT rc EQUAL 0)
+    message( FATAL_ERROR "${FILTER} failed on the output of ${SOURCE}" )
+  endif()
+endif()
+
+file( STRINGS ${SOURCE} expects REGEX "^// expect [0-9]+: " )
+if(NOT expects)
+  message( FATAL_ERROR "${SOURCE} has no `// expect <N>: <text>` lines" )
+endif()
+
+set( failed FALSE )
+foreach( e ${expects} )
+  string( REGEX REPLACE "^// expect ([0-9]+): (.*)$" "\\1" n "${e}" )
+  string( REGEX REPLACE "^// expect ([0-9]+): (.*)$" "\\2" text "${e}" )
+  string( LENGTH "${text}" len )
+  set( rest "${out}" )
+  set( found 0 )
+  string( FIND "${rest}" "${text}" at )
+  while(NOT at EQUAL -1)
+    math( EXPR found "${found} + 1" )
+    math( EXPR at "${at} + ${len}" )
+    string( SUBSTRING "${rest}" ${at} -1 rest )
+    string( FIND "${rest}" "${text}" at )
+  endwhile()
+  if(NOT found EQUAL n)
+    message( "expected ${n}, found ${found}: ${text}" )
+    set( failed TRUE )
+  endif()
+endforeach()
+
+if(failed)
+  message( FATAL_ERROR "unexpected diagnostics of ${SOURCE}:\n${out}" )
+endif()
@@ -0,0 +1,35 @@
+// A failing composition of layout or value matchers shows the numbers of its first failing operand.
+//
+// expect 1: static failure: AllOf<FitsInCacheLine,NoPadding,OffsetOf<next_at_,0>>
+// expect 1: Type0<st::detail::layout_<Node, 72, 8> >
+// expect 1: static failure: Not<SizeIs<24>>
+// expect 1: Type0<st::detail::layout_<Pair, 24, 8> >
+// expect 1: static failure: AllOf<Lt<5>,Ne<4>>
+// expect 1: static failure: Not<Between<0,9>>
+// expect 1: Type0<st::detail::value_<std::integral_constant<int, 4>, int, 4> >
+
+#include <static_test/static_expect.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+using namespace st::static_matchers;
+
+struct Node {
+    char tag;
+    char payload[59];
+    void* next;
+};
+
+struct Pair {
+    void* first;
+    void* second;
+    void* third;
+};
+
+template<class T> using next_at_ = std::integral_constant<std::size_t, offsetof(T, next)>;
+
+STATIC_EXPECT_THAT( Node, (AllOf<FitsInCacheLine, NoPadding, OffsetOf<next_at_, 0>>) );
+STATIC_EXPECT_THAT( Pair, Not<SizeIs<24>> );
+STATIC_EXPECT_THAT( (std::integral_constant<int, 4>), (AllOf<Lt<5>, Ne<4>>) );
+STATIC_EXPECT_THAT( (std::integral_constant<int, 4>), (Not<Between<0, 9>>) );
@@ -0,0 +1,21 @@
+// A non-dependent assertion in a template is checked once, at the definition, however many
+// specializations there are; a dependent one is checked with every specialization.
+//
+// expect 1: static failure: Is<long>
+// expect 2: static failure: Is<int>
+// expect 1: Type0<int>
+
+#include <static_test/static_expect.hpp>
+
+using namespace st::static_matchers;
+
+template<class T>
+struct Templ {
+    STATIC_EXPECT_THAT( int, Is<long> );
+    STATIC_EXPECT_THAT( T, Is<int> );
+};
+
+Templ<int> i;
+Templ<char> c;
+Templ<short> s;
+Templ<char> again;
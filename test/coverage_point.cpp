@@ -0,0 +1,32 @@
+#define ST_STATIC_EXPECT_CONFIG_COVERAGE 1
+
+#include <static_test/coverage.hpp>
+
+#include <type_traits>
+
+namespace {
+
+template<class T> struct Rank;
+
+template<class T> struct Rank<T*> {
+    ST_COVERAGE_POINT( Rank<T*> );
+    using type = std::integral_constant<int, 1 + Rank<T>::type::value>;
+};
+
+template<class T> struct Rank {
+    ST_COVERAGE_POINT( Rank<T> );
+    ST_COVERAGE_POINT( Rank<T>, second point in the same class );
+    using type = std::integral_constant<int, 0>;
+};
+
+// Never instantiated: tools/st_coverage.py lists it as unexercised
+template<class T> struct Rank<T&> {
+    ST_COVERAGE_POINT( Rank<T&> );
+    using type = typename Rank<T>::type;
+};
+
+} // namespace
+
+// The markers change nothing about the specializations
+static_assert( Rank<int**>::type::value == 2, "" );
+static_assert( std::is_empty< Rank<int> >::value, "" );
@@ -27,6 +27,7 @@ template<class A, template<class...> class B> struct mp_rename;
 template<template<class...> class A, class... T, template<class...> class B>
 struct mp_rename<A<T...>, B>
 {
+    ST_COVERAGE_POINT( mp_rename<A<T...>, B> );
     using type = B<T...>;
 };
 }
@@ -48,6 +49,7 @@ template<class L> struct mp_size_impl;
 
 template<template<class...> class L,  class... T> struct mp_size_impl<L<T...>>
 {
+    ST_COVERAGE_POINT( mp_size_impl<L<T...>> );
     using type = std::integral_constant<std::size_t, sizeof...(T)>;
 };
 
@@ -0,0 +1,108 @@
+#include <static_test/static_expect.hpp>
+
+#include <type_traits>
+#include <utility>
+
+using namespace st::static_matchers;
+
+namespace {
+
+template<class M, class... T>
+constexpr bool matches() { return st::detail::InvokeMatcher<M, T...>::value; }
+
+template<class T> using run_   = decltype(&T::run);
+template<class T> using state_ = decltype(&T::state);
+template<class T> using make_  = decltype(&T::make);
+template<class T> using run_nothrow_ =
+    std::integral_constant<bool, noexcept(std::declval<T const&>().run(0))>;
+
+struct alignas(8) FastPolicy {
+    void run(int) const noexcept {}
+    static FastPolicy make() { return FastPolicy{}; }
+    long state;
+};
+
+struct SlowPolicy {
+    virtual ~SlowPolicy() {}
+    void run(int) {}
+};
+
+struct NoRun {};
+
+struct ZeroOverhead
+    : Requirements< HasSignature<run_, void(int) const>, IsNoexcept<run_nothrow_>,
+                    IsTriviallyCopyable, SizeIs<sizeof(long)>, AlignmentIs<8> > {};
+
+} // namespace
+
+//     +-----------+
+//     |  Members  |
+//     +-----------+
+
+static_assert(  matches< HasMember<run_>, FastPolicy >(),                                    "" );
+static_assert(  matches< HasMember<run_>, SlowPolicy >(),                                    "" );
+static_assert( !matches< HasMember<run_>, NoRun >(),                                         "" );
+static_assert( !matches< HasMember<run_>, int >(),                                           "" );
+
+static_assert(  matches< HasSignature<run_, void(int) const>, FastPolicy >(),               "" );
+static_assert(  matches< HasSignature<run_, void(int) const noexcept>, FastPolicy >(),      "" );
+static_assert(  matches< HasSignature<run_, void(int)>, SlowPolicy >(),                      "" );
+static_assert( !matches< HasSignature<run_, void(int) const>, SlowPolicy >(),                "" );
+static_assert( !matches< HasSignature<run_, void(int)>, NoRun >(),                           "" );
+static_assert(  matches< HasSignature<state_, long>, FastPolicy >(),                         "data" );
+static_assert(  matches< HasSignature<make_, FastPolicy()>, FastPolicy >(),                  "static" );
+
+static_assert(  matches< IsNoexcept<run_nothrow_>, FastPolicy >(),                           "" );
+static_assert( !matches< IsNoexcept<run_nothrow_>, SlowPolicy >(),                           "" );
+static_assert( !matches< IsNoexcept<run_nothrow_>, NoRun >(),                                "" );
+
+#if ST_CONFIG_HAS_NOEXCEPT_FUNCTION_TYPE
+static_assert(  matches< IsNoexcept<run_>, FastPolicy >(),                                   "" );
+static_assert( !matches< IsNoexcept<run_>, SlowPolicy >(),                                   "" );
+#endif
+
+
+//     +----------+
+//     |  Layout  |
+//     +----------+
+
+static_assert(  matches< SizeIs<sizeof(long)>, FastPolicy >(),                              "" );
+static_assert( !matches< SizeIs<1>, FastPolicy >(),                                          "" );
+static_assert(  matches< AlignmentIs<8>, FastPolicy >(),                                     "" );
+static_assert( !matches< AlignmentIs<1>, FastPolicy >(),                                     "" );
+static_assert(  matches< IsTriviallyCopyable, FastPolicy >(),                                "" );
+static_assert( !matches< IsTriviallyCopyable, SlowPolicy >(),                                "" );
+
+
+//     +--------------+
+//     |  Interfaces  |
+//     +--------------+
+
+static_assert( std::is_same< st::detail::InvokeMatcher<ConformsTo<ZeroOverhead>, FastPolicy>,
+                             std::true_type >::value,                                        "" );
+static_assert( !matches< ConformsTo<ZeroOverhead>, SlowPolicy >(),                          "" );
+static_assert( !matches< ConformsTo<ZeroOverhead>, NoRun >(),                               "" );
+static_assert(  matches< ConformsTo<Requirements<>>, NoRun >(),                             "" );
+static_assert( std::is_same< st::detail::t_<st::detail::shown_<void, ConformsTo<ZeroOverhead>, NoRun>>,
+                             st::detail::layout_<NoRun, 1, 1> >::value,                      "" );
+static_assert( std::is_same< st::detail::t_<st::detail::shown_<void, ConformsTo<ZeroOverhead>, SlowPolicy>>,
+                             st::detail::layout_<SlowPolicy, sizeof(void*), alignof(void*)> >::value, "" );
+
+STATIC_EXPECT_THAT( FastPolicy, ConformsTo<ZeroOverhead> );
+STATIC_EXPECT_THAT( SlowPolicy, Not<ConformsTo<ZeroOverhead>> );
+STATIC_EXPECT_THAT( FastPolicy, (AllOf<HasMember<state_>, HasSignature<make_, FastPolicy()>>) );
+
+// Locking in a CRTP base's expectations of the derived class, at the point of use
+template<class Derived>
+struct Engine {
+    void step() {
+        STATIC_EXPECT_THAT( Derived, ConformsTo<ZeroOverhead> );
+        static_cast<Derived const*>(this)->run(0);
+    }
+};
+
+struct FastEngine : Engine<FastEngine> {
+    void run(int) const noexcept {}
+    long state;
+};
+template void Engine<FastEngine>::step();
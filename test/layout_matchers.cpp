@@ -0,0 +1,104 @@
+#include <static_test/static_expect.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+using namespace st::static_matchers;
+
+namespace {
+
+template<class M, class... T>
+constexpr bool matches() { return st::detail::InvokeMatcher<M, T...>::value; }
+
+template<class M, class T>
+using shown = st::detail::t_<st::detail::shown_<void, M, T>>;
+
+struct Packed {
+    std::uint32_t key;
+    std::uint32_t value;
+    std::uint64_t next;
+};
+
+struct Padded {
+    char tag;
+    std::uint64_t value;
+};
+
+struct alignas(64) Line {
+    std::uint64_t counter;
+};
+
+struct Big {
+    char bytes[65];
+};
+
+template<class T> using next_at_  = std::integral_constant<std::size_t, offsetof(T, next)>;
+template<class T> using value_at_ = std::integral_constant<std::size_t, offsetof(T, value)>;
+
+} // namespace
+
+//     +----------+
+//     |  Layout  |
+//     +----------+
+
+static_assert(  matches< FitsInCacheLine, Packed >(),                                        "" );
+static_assert(  matches< FitsInCacheLine, Line >(),                                          "" );
+static_assert( !matches< FitsInCacheLine, Big >(),                                           "" );
+
+static_assert(  matches< AlignedTo<64>, Line >(),                                            "" );
+static_assert(  matches< AlignedTo<8>, Line >(),                                             "multiple" );
+static_assert( !matches< AlignedTo<64>, Packed >(),                                          "" );
+
+static_assert(  matches< OffsetOf<next_at_, 8>, Packed >(),                                  "" );
+static_assert(  matches< OffsetOf<value_at_, 4>, Packed >(),                                 "" );
+static_assert( !matches< OffsetOf<value_at_, 1>, Padded >(),                                 "" );
+
+#if ST_CONFIG_HAS_UNIQUE_OBJECT_REPRESENTATIONS
+static_assert(  matches< NoPadding, Packed >(),                                              "" );
+static_assert( !matches< NoPadding, Padded >(),                                              "" );
+static_assert( !matches< NoPadding, double >(),                                              "float" );
+#endif
+
+
+//     +---------------+
+//     |  Diagnostics  |
+//     +---------------+
+
+// Failing layout matchers show the numbers; other matchers show the type as is
+static_assert( std::is_same< shown<FitsInCacheLine, Big>, st::detail::layout_<Big, 65, 1> >::value, "" );
+static_assert( std::is_same< shown<AlignedTo<64>, Line>, st::detail::layout_<Line, 64, 64> >::value, "" );
+static_assert( std::is_same< shown<SizeIs<1>, Packed>, st::detail::layout_<Packed, 16, 8> >::value, "" );
+static_assert( std::is_same< shown<OffsetOf<value_at_, 1>, Padded>,
+                             st::detail::offset_<Padded, value_at_, 8> >::value,                "" );
+static_assert( std::is_same< shown<Is<int>, Big>, Big >::value,                               "" );
+
+// Composed, a failure shows what the first failing operand with a `show` shows
+static_assert( std::is_same< shown<AllOf<Is<Big>, SizeIs<65>, FitsInCacheLine>, Big>,
+                             st::detail::layout_<Big, 65, 1> >::value,                          "" );
+static_assert( std::is_same< shown<AllOf<FitsInCacheLine, OffsetOf<value_at_, 1>>, Padded>,
+                             st::detail::offset_<Padded, value_at_, 8> >::value,                "" );
+static_assert( std::is_same< shown<AnyOf<Is<int>, SizeIs<1>, AlignedTo<16>>, Packed>,
+                             st::detail::layout_<Packed, 16, 8> >::value,                       "" );
+static_assert( std::is_same< shown<Not<SizeIs<16>>, Packed>,
+                             st::detail::layout_<Packed, 16, 8> >::value,                       "" );
+static_assert( std::is_same< shown<Not<AllOf<NoPadding, FitsInCacheLine>>, Packed>,
+                             st::detail::layout_<Packed, 16, 8> >::value,                       "" );
+static_assert( std::is_same< shown<AllOf<Is<int>, Not<Is<Big>>>, Big>, Big >::value,        "" );
+
+
+//     +---------------------+
+//     |  Through the macro  |
+//     +---------------------+
+
+STATIC_EXPECT_THAT( Packed, (AllOf< FitsInCacheLine, SizeIs<16>, OffsetOf<next_at_, 8> >) );
+STATIC_EXPECT_THAT( Line, (AllOf< AlignedTo<ST_STATIC_EXPECT_CONFIG_CACHE_LINE_SIZE>,
+                                  SizeIs<ST_STATIC_EXPECT_CONFIG_CACHE_LINE_SIZE> >) );
+STATIC_EXPECT_THAT( Big, Not<FitsInCacheLine> );
+
+template<class T>
+struct Slot {
+    T value;
+    STATIC_EXPECT_DEFERRED( STATIC_EXPECT_THAT( Slot<T>, FitsInCacheLine ) );
+};
+template struct Slot<Packed>;
@@ -0,0 +1,29 @@
+// tools/st_log2json.py on the diagnostics of failing assertions (see compile_fail/check.cmake):
+// each specialization an assertion fails in is listed, reported where it was instantiated, and a
+// failure outside of templates at its own line, even right after one in a template.
+//
+// expect 3: {"file": "
+// expect 2: "line": 22, "matcher": "Is<int>", "args": [{"index": 0, "expr": "T"}]
+// expect 1: Templ<char>", "reported_at": "
+// expect 1: failures.cpp:25", "tu"
+// expect 1: Templ<long
+// expect 1: failures.cpp:26", "tu"
+// expect 1: "line": 29, "matcher": "Is<int>", "args": [{"index": 0, "expr": "long"}], "context": null
+// expect 1: failures.cpp:29", "tu"
+
+#define ST_STATIC_EXPECT_CONFIG_STRUCTURED_MESSAGE 1
+
+#include <static_test/static_expect.hpp>
+
+using namespace st::static_matchers;
+
+template<class T>
+struct Templ {
+    STATIC_EXPECT_THAT( T, Is<int> );
+};
+
+Templ<char> c;
+Templ<long> l;
+Templ<char> again;
+
+STATIC_EXPECT_THAT( long, Is<int> );
@@ -0,0 +1,51 @@
+#include <static_test/static_expect.hpp>
+
+#include <boost/mpl/lambda.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+using namespace st::static_matchers;
+
+namespace {
+
+template<int N> struct Entry {};
+
+using Registry = std::tuple< Entry<0>, Entry<1>, Entry<2>, Entry<3>, Entry<4>, Entry<5>, Entry<6> >;
+
+template<class... T> Registry make_registry(T...) { return Registry{}; }
+
+ST_DEFINE_MATCHER( IsRegistry, (Is<std::tuple< Entry<0>, Entry<1>, Entry<2>, Entry<3>,
+                                               Entry<4>, Entry<5>, Entry<6> >>) );
+
+ST_DEFINE_MATCHER( IsSmall, Lt<8> );
+
+template<class T> ST_DEFINE_MATCHER( IsPairOf, (Is<std::pair<T, T>>) );
+
+ST_DEFINE_MATCHER( IsInt, boost::mpl::lambda<std::is_same<boost::mpl::_1, int>>::type );
+
+} // namespace
+
+// A distinct class, not an alias
+static_assert( !std::is_same< IsRegistry, Is<Registry> >::value,                        "" );
+static_assert( std::is_base_of< Is<Registry>, IsRegistry >::value,                      "" );
+
+// Same results as the matcher it names
+static_assert( st::detail::InvokeMatcher< IsRegistry, Registry >::value,                "" );
+static_assert( !st::detail::InvokeMatcher< IsRegistry, Entry<0> >::value,               "" );
+static_assert( st::detail::InvokeMatcher< IsInt, int >::value,                          "" );
+static_assert( !st::detail::InvokeMatcher< IsInt, long >::value,                        "" );
+
+STATIC_EXPECT_THAT( Registry, IsRegistry );
+STATIC_EXPECT_THAT_EXPR( make_registry(1, 2), IsRegistry );
+STATIC_EXPECT_THAT( (std::tuple<Entry<0>>), Not<IsRegistry> );
+STATIC_EXPECT_THAT( (std::integral_constant<int, 3>), IsSmall );
+STATIC_EXPECT_THAT_VALUE( sizeof(Entry<0>), IsSmall );
+STATIC_EXPECT_THAT( (std::pair<int, int>), IsPairOf<int> );
+STATIC_EXPECT_THAT( Registry, int, (AllOf<Bind<IsRegistry, 0>, Bind<IsInt, 1>>) );
+
+struct Holder {
+    ST_DEFINE_MATCHER( IsHolder, Is<Holder> );
+    void f() { STATIC_EXPECT_THAT( Holder, IsHolder ); }
+};
@@ -23,3 +23,7 @@ static_assert(std::is_same< T3, std::vector<int> >::value, "t3");
 // Multi comma, multi paren
 using T4 = std::vector< ST_PP_REMOVE_PAREN(((std::pair<int, double>))) >;
 static_assert(std::is_same< T4, std::vector<std::pair<int, double>> >::value, "t4");
+
+// Parenthesis inside the expression are kept
+using T5 = std::vector< ST_PP_REMOVE_PAREN((std::pair<int(double), char>)) >;
+static_assert(std::is_same< T5, std::vector<std::pair<int(double), char>> >::value, "t5");
@@ -0,0 +1,88 @@
+#include <static_test/runtime_expect.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+
+using namespace st::static_matchers;
+
+namespace {
+
+struct Widget {};
+
+// The last failure, copied out of the arena
+std::string lastReport;
+std::size_t lastNumTypes;
+std::string lastType;
+void keepLast( st::runtime::failure const& f ) {
+    lastReport.assign(f.report.data, f.report.size);
+    lastNumTypes = f.numTypes;
+    lastType.assign(f.types[f.numTypes - 1].data, f.types[f.numTypes - 1].size);
+}
+
+std::string str( st::runtime::text t ) { return std::string(t.data, t.size); }
+
+} // namespace
+
+// Type names are found at compile time
+static_assert( st::runtime::typeName<int>().size == 3, "" );
+static_assert( st::runtime::typeName<double>().size == 6, "" );
+
+TEST( RuntimeExpect, TypeName ) {
+    EXPECT_EQ( "int", str(st::runtime::typeName<int>()) );
+    EXPECT_EQ( "double", str(st::runtime::typeName<double>()) );
+    EXPECT_EQ( "unsigned char", str(st::runtime::typeName<unsigned char>()) );
+#if defined(ST_CONFIG_GCC)
+    EXPECT_EQ( "{anonymous}::Widget", str(st::runtime::typeName<Widget>()) );
+    EXPECT_EQ( "std::pair<int, long int>", str(st::runtime::typeName<std::pair<int, long>>()) );
+    EXPECT_EQ( "std::pair<double, double>", str(st::runtime::typeName<std::pair<double, double>>()) );
+#endif
+}
+
+TEST( RuntimeExpect, Pass ) {
+    unsigned long long checks = st::runtime::stats().checks;
+    unsigned long long failures = st::runtime::stats().failures;
+
+    EXPECT_TRUE(( RUNTIME_EXPECT_THAT( int, Is<int> ) ));
+    EXPECT_TRUE(( RUNTIME_EXPECT_THAT( (std::pair<int, long>), (Is<std::pair<int, long>>) ) ));
+    EXPECT_TRUE(( RUNTIME_EXPECT_THAT_EXPR( 1 + 2L, Is<long> ) ));
+    EXPECT_TRUE(( RUNTIME_EXPECT_THAT( int, long, (AllOf<Bind<Is<int>, 0>, Bind<Is<long>, 1>>) ) ));
+
+    EXPECT_EQ( checks + 4, st::runtime::stats().checks );
+    EXPECT_EQ( failures, st::runtime::stats().failures );
+}
+
+TEST( RuntimeExpect, Fail ) {
+    st::runtime::sink_fn previous = st::runtime::setFailureSink(&keepLast);
+    unsigned long long failures = st::runtime::stats().failures;
+
+    bool passed = RUNTIME_EXPECT_THAT( Widget, long, (Bind<Is<int>, 1>) );
+    st::runtime::setFailureSink(previous);
+
+    EXPECT_FALSE( passed );
+    EXPECT_EQ( failures + 1, st::runtime::stats().failures );
+    EXPECT_EQ( 2u, lastNumTypes );
+    EXPECT_EQ( 0u, lastReport.find("[st-failure`") );
+    EXPECT_NE( std::string::npos, lastReport.find("`Bind<Is<int>,1>`0:Widget`1:long`]") );
+#if defined(ST_CONFIG_GCC)
+    EXPECT_NE( std::string::npos, lastReport.find(", Type0 = {anonymous}::Widget, Type1 = long int") );
+#endif
+}
+
+// More types than STATIC_EXPECT_THAT shows are fine at run time
+TEST( RuntimeExpect, FailManyTypes ) {
+    st::runtime::sink_fn previous = st::runtime::setFailureSink(&keepLast);
+
+    bool passed = RUNTIME_EXPECT_THAT( char, short, int, long, float, double, Widget,
+                                       (Bind<Is<int>, 6>) );
+    st::runtime::setFailureSink(previous);
+
+    EXPECT_FALSE( passed );
+    EXPECT_EQ( 7u, lastNumTypes );
+    EXPECT_NE( std::string::npos, lastReport.find("`5:double`6:Widget`]") );
+    EXPECT_NE( std::string::npos, lastReport.find(", Type5 = double, Type6 = ") );
+#if defined(ST_CONFIG_GCC)
+    EXPECT_EQ( "{anonymous}::Widget", lastType );
+#endif
+}
@@ -0,0 +1,73 @@
+#include <static_test/static_expect.hpp>
+
+#include <type_traits>
+
+using namespace st::static_matchers;
+
+//     +-------------------+
+//     |  Namespace scope  |
+//     +-------------------+
+
+STATIC_EXPECT_THAT( int, Is<int> );
+
+// Any number of assertions on one line
+STATIC_EXPECT_THAT( int, Is<int> ); STATIC_EXPECT_THAT( long, IsNot<int> );
+
+namespace inner {
+    STATIC_EXPECT_THAT( char, Is<char> );
+}
+
+
+//     +---------------+
+//     |  Class scope  |
+//     +---------------+
+
+struct Plain {
+    STATIC_EXPECT_THAT( int, Is<int> ); STATIC_EXPECT_THAT( long, IsNot<int> );
+    int member;
+};
+
+template<class T>
+struct Templ {
+    // non-dependent: checked once
+    STATIC_EXPECT_THAT( int, Is<int> );
+
+    // dependent: checked with every specialization
+    STATIC_EXPECT_THAT( T, IsNot<void> );
+    STATIC_EXPECT_THAT_VALUE( sizeof(T), Lt<64> );
+
+    // deferred: checked with explicit instantiations only
+    STATIC_EXPECT_DEFERRED( STATIC_EXPECT_THAT( T, (AnyOf<Is<int>, Is<long>>) ) );
+
+    T member;
+};
+
+// The assertions add nothing to the class
+static_assert( sizeof(Plain) == sizeof(int), "no layout change" );
+static_assert( sizeof(Templ<char>) == sizeof(char), "no layout change" );
+
+// char does not satisfy the deferred assertion, but is never explicitly instantiated
+Templ<char> implicitly_instantiated;
+
+template struct Templ<int>;
+template struct Templ<long>;
+
+
+//     +------------------+
+//     |  Function scope  |
+//     +------------------+
+
+void plain_function() {
+    constexpr int n = 3;
+    STATIC_EXPECT_THAT_VALUE( n, Eq<3> ); STATIC_EXPECT_THAT( int, Is<int> );
+    STATIC_EXPECT_DEFERRED( STATIC_EXPECT_THAT_VALUE( n, Lt<4> ) );
+}
+
+template<class T>
+T templated_function(T t) {
+    STATIC_EXPECT_THAT( int, Is<int> );
+    STATIC_EXPECT_THAT_EXPR( t + t, Is<T> );
+    return t;
+}
+
+template long templated_function(long);
@@ -0,0 +1,77 @@
+#include <static_test/static_expect.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+using namespace st::static_matchers;
+
+namespace {
+
+constexpr int sq(int x) { return x*x; }
+
+constexpr std::size_t count(int a, int b) { return static_cast<std::size_t>(b - a); }
+
+enum class Color { red, green, blue };
+
+int const seven = 7;
+
+} // namespace
+
+//     +--------------------------------+
+//     |  Same matchers, type or value  |
+//     +--------------------------------+
+
+STATIC_EXPECT_THAT( (std::integral_constant<int, 9>), Eq<9> );
+STATIC_EXPECT_THAT_VALUE( sq(3), Eq<9> );
+
+STATIC_EXPECT_THAT( (std::integral_constant<int, 2>), Lt<3> );
+STATIC_EXPECT_THAT_VALUE( sq(1) + 1, Lt<3> );
+
+STATIC_EXPECT_THAT( (std::integral_constant<int, 5>), (InRange<0, 10>) );
+STATIC_EXPECT_THAT_VALUE( seven, (InRange<0, 10>) );
+
+// Arguments containing commas are guarded by parenthesis, just as with types
+STATIC_EXPECT_THAT_VALUE( (count(2, 5)), Eq<3> );
+
+// Bounds are inclusive
+STATIC_EXPECT_THAT_VALUE( sq(2), (InRange<4, 4>) );
+
+
+//     +------------------------------------+
+//     |  The value type is kept, not int   |
+//     +------------------------------------+
+
+STATIC_EXPECT_THAT_EXPR( count(0,1), Is<std::size_t> );
+STATIC_EXPECT_THAT_VALUE( true, Eq<true> );
+STATIC_EXPECT_THAT_VALUE( 'a', (InRange<'a', 'z'>) );
+
+
+#if ST_CONFIG_HAS_AUTO_NTTP
+
+STATIC_EXPECT_THAT_VALUE( Color::green, Eq<Color::green> );
+
+#endif
+
+
+#if ST_CONFIG_HAS_CLASS_NTTP
+
+namespace {
+
+struct Point {
+    int x;
+    int y;
+    constexpr bool operator==(Point const& o) const { return x == o.x && y == o.y; }
+    constexpr bool operator< (Point const& o) const { return x < o.x || (x == o.x && y < o.y); }
+};
+
+constexpr Point mirror(Point p) { return Point{ p.y, p.x }; }
+
+constexpr Point origin{ 0, 0 };
+constexpr Point corner{ 5, 5 };
+
+} // namespace
+
+STATIC_EXPECT_THAT_VALUE( (mirror(Point{1, 2})), (Eq<Point{2, 1}>) );
+STATIC_EXPECT_THAT_VALUE( (mirror(Point{1, 2})), (InRange<origin, corner>) );
+
+#endif
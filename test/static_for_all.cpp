@@ -0,0 +1,100 @@
+#include <static_test/static_expect.hpp>
+
+#include <type_traits>
+
+using namespace st::static_matchers;
+
+namespace {
+
+struct IsConvertible {
+    template<class From, class To>
+    struct apply : std::is_convertible<From, To> {};
+};
+
+struct SumBelow12 {
+    template<class A, class B>
+    struct apply : std::integral_constant<bool, (sizeof(A) + sizeof(B) < 12)> {};
+};
+
+template<class... T> using list = st::detail::list_<T...>;
+
+} // namespace
+
+//     +-----------+
+//     |  Helpers  |
+//     +-----------+
+
+static_assert( std::is_same< st::detail::make_index_seq<0>, st::detail::index_seq<> >::value,         "" );
+static_assert( std::is_same< st::detail::make_index_seq<5>, st::detail::index_seq<0,1,2,3,4> >::value, "" );
+
+static_assert( std::is_same< st::detail::type_at_<0, list<char, int, int>>, char >::value,             "" );
+static_assert( std::is_same< st::detail::type_at_<2, list<char, int, int>>, int >::value,              "" );
+
+// The last list varies fastest
+static_assert( st::detail::digit_(5, 0, 2, 3) == 1 && st::detail::digit_(5, 1, 2, 3) == 2,           "" );
+
+static_assert(  st::detail::ForAll< SumBelow12, list<char, short, int>, list<char, int> >::value,     "" );
+static_assert( !st::detail::ForAll< SumBelow12, list<char, long, int>, list<char, int> >::value,      "" );
+
+// The first failing combination: (long, int), ahead of (int, long) and (long, long)
+using Failing = st::detail::ForAll< SumBelow12, list<char, long, int>, list<char, int, long> >;
+static_assert( std::is_same< Failing::failing<0>, long >::value,                                      "" );
+static_assert( std::is_same< Failing::failing<1>, int >::value,                                       "" );
+
+// No combinations at all holds vacuously
+static_assert( st::detail::ForAll< SumBelow12, list<>, list<char> >::value,                           "" );
+
+
+//     +---------------------+
+//     |  Through the macro  |
+//     +---------------------+
+
+STATIC_FOR_ALL( (signed char, short, int, long), (float, double), IsConvertible );
+STATIC_FOR_ALL( (char, short, int), (char, int), SumBelow12 );
+
+// A single list, and single-type lists
+STATIC_FOR_ALL( (char, short, int), Not<Is<void>> );
+STATIC_FOR_ALL( (int), (long), (AllOf<Bind<Is<int>, 0>, Bind<Is<long>, 1>>) );
+
+// Dependent lists, at class scope
+template<class T>
+struct Widening {
+    STATIC_FOR_ALL( (T, T const), (long long, double), IsConvertible );
+};
+template struct Widening<int>;
+template struct Widening<short>;
+
+
+//     +--------------+
+//     |  Transforms  |
+//     +--------------+
+
+namespace {
+
+struct IsIntegral {
+    template<class T>
+    struct apply : std::is_integral<T> {};
+};
+
+struct IsConst {
+    template<class T>
+    struct apply : std::is_const<T> {};
+};
+
+} // namespace
+
+// Each transform applies to the type before it, and is not an argument of its own
+static_assert( std::is_same< st::detail::t_<st::detail::fold_< list<>, int, AddConst >>,
+                             list<int const> >::value,                                                "" );
+static_assert( std::is_same< st::detail::t_<st::detail::fold_< list<>, int, AsIs, long, AddPointer, AddCV >>,
+                             list<int, long* const volatile> >::value,                                "" );
+
+STATIC_FOR_ALL( (char, short, int, long), (AsIs, AddConst, AddVolatile, AddCV), IsIntegral );
+STATIC_FOR_ALL( (int, long), (AddConst, AddCV), (long long, double), (AsIs, AddConst), IsConvertible );
+STATIC_FOR_ALL( (int, double), (Transform<std::add_const>), IsConst );
+
+// The first failing combination names the transform: (int, AsIs)
+using FailingTransform = st::detail::ForAll< IsConst, list<int, long>, list<AddConst, AsIs> >;
+static_assert( !FailingTransform::value,                                                              "" );
+static_assert( std::is_same< FailingTransform::failing<0>, int >::value,                              "" );
+static_assert( std::is_same< FailingTransform::failing<1>, AsIs >::value,                             "" );
@@ -0,0 +1,58 @@
+#include <static_test/static_expect.hpp>
+
+#include <boost/mpl/placeholders.hpp>
+#include <type_traits>
+
+using namespace st::static_matchers;
+
+namespace {
+
+template<class M, class... T>
+constexpr bool matches() { return st::detail::InvokeMatcher<M, T...>::value; }
+
+} // namespace
+
+//     +--------------+
+//     |  Invocation  |
+//     +--------------+
+
+// Metafunction classes are called directly, MPL lambda expressions as mpl::apply would
+static_assert(  matches< Is<int>, int >(),                                          "direct" );
+static_assert(  matches< std::is_same<boost::mpl::_1, int>, int >(),                "lambda" );
+static_assert( !matches< std::is_same<boost::mpl::_1, int>, long >(),               "lambda" );
+static_assert(  matches< std::is_same<boost::mpl::_2, boost::mpl::_1>, int, int >(), "lambda" );
+static_assert( !matches< std::is_same<boost::mpl::_2, int>, int, long >(),          "lambda" );
+static_assert(  matches< std::is_same<std::add_pointer<boost::mpl::_1>, int*>, int >(), "nested" );
+static_assert(  matches< std::is_same<std::add_const<int>, boost::mpl::_1>,
+                         std::add_const<int> >(),                                   "unbound" );
+
+// The result is always a plain bool_constant
+static_assert( std::is_same< st::detail::InvokeMatcher<Is<int>, int>, std::true_type >::value, "" );
+static_assert( std::is_same< st::detail::InvokeMatcher<IsNot<int>, int>, std::false_type >::value, "" );
+
+
+//     +---------------+
+//     |  Combinators  |
+//     +---------------+
+
+static_assert(  matches< IsNot<int>, long >(),                                      "not" );
+static_assert( !matches< IsNot<int>, int >(),                                       "not" );
+static_assert(  matches< Not<Not<Is<int>>>, int >(),                                "not not" );
+
+static_assert(  matches< AllOf<>, int >(),                                          "empty all" );
+static_assert( !matches< AnyOf<>, int >(),                                          "empty any" );
+static_assert(  matches< AllOf<IsNot<int>, IsNot<char>>, long >(),                 "all" );
+static_assert( !matches< AllOf<IsNot<int>, IsNot<long>>, long >(),                 "all" );
+static_assert(  matches< AnyOf<Is<int>, Is<long>>, long >(),                       "any" );
+static_assert( !matches< AnyOf<Is<int>, Is<char>>, long >(),                       "any" );
+static_assert(  matches< Not<AnyOf<Is<int>, Is<char>>>, long >(),                  "none" );
+
+static_assert(  matches< Bind<Is<long>, 1>, int, long >(),                         "bind" );
+static_assert(  matches< Bind<Bind<Is<long>, 0>, 1>, int, long >(),               "bind bind" );
+static_assert(  matches< AllOf<Bind<Is<int>, 0>, Bind<Is<long>, 1>>, int, long >(), "bind all" );
+static_assert( !matches< AllOf<Bind<Is<int>, 0>, Bind<Is<long>, 1>>, long, int >(), "bind all" );
+
+// Through the macros, mixed with value matchers
+STATIC_EXPECT_THAT( long, IsNot<int> );
+STATIC_EXPECT_THAT( (std::integral_constant<int, 3>), (AllOf<Lt<5>, Not<Eq<4>>>) );
+STATIC_EXPECT_THAT( int, long, (AllOf<Bind<Is<int>, 0>, Bind<Is<long>, 1>>) );
@@ -0,0 +1,194 @@
+#include <static_test/static_expect.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#if ST_CONFIG_HAS_STRING_VIEW
+#  include <string_view>
+#endif
+
+using namespace st::static_matchers;
+
+namespace {
+
+template<class M, class... T>
+constexpr bool matches() { return st::detail::InvokeMatcher<M, T...>::value; }
+
+#define ST_TEST_STRING_(name, s) struct name { static constexpr char const* value = s; }
+
+ST_TEST_STRING_( Query,   "SELECT id, name FROM users WHERE id = ?;" );
+ST_TEST_STRING_( Select,  "SELECT " );
+ST_TEST_STRING_( Where,   "WHERE" );
+ST_TEST_STRING_( Semi,    ";" );
+ST_TEST_STRING_( Empty,   "" );
+ST_TEST_STRING_( Insert,  "INSERT " );
+
+#undef ST_TEST_STRING_
+
+// Any of the string forms
+struct Array { static constexpr char value[16] = "SELECT "; };   // null terminated before the end
+constexpr char Array::value[16];
+
+} // namespace
+
+//     +------------------------+
+//     |  Equality and affixes  |
+//     +------------------------+
+
+static_assert(  matches< StrEq<Query>, Query >(),                                          "" );
+static_assert( !matches< StrEq<Select>, Query >(),                                         "" );
+static_assert(  matches< StrEq<Array>, Select >() && matches< StrEq<Select>, Array >(),    "" );
+static_assert(  matches< StrEq<Empty>, Empty >() && !matches< StrEq<Empty>, Semi >(),     "" );
+
+static_assert(  matches< StartsWith<Select>, Query >(),                                    "" );
+static_assert(  matches< StartsWith<Empty>, Query >(),                                     "" );
+static_assert( !matches< StartsWith<Insert>, Query >(),                                    "" );
+static_assert( !matches< StartsWith<Query>, Select >(),                                    "" );
+
+static_assert(  matches< EndsWith<Semi>, Query >() && !matches< EndsWith<Semi>, Select >(), "" );
+static_assert( !matches< EndsWith<Query>, Semi >(),                                        "" );
+
+static_assert(  matches< Contains<Where>, Query >() && matches< Contains<Query>, Query >(), "" );
+static_assert( !matches< Contains<Insert>, Query >() && !matches< Contains<Query>, Where >(), "" );
+
+STATIC_EXPECT_THAT( Query, (AllOf<StartsWith<Select>, Contains<Where>, EndsWith<Semi>>) );
+STATIC_EXPECT_THAT( Query, Not<StartsWith<Insert>> );
+
+
+//     +--------+
+//     |  Glob  |
+//     +--------+
+
+namespace {
+
+struct G1 { static constexpr char const* value = "SELECT * FROM users *;"; };
+struct G2 { static constexpr char const* value = "SELECT ?? FROM*"; };
+struct G3 { static constexpr char const* value = "*[Ww][Hh][Ee][Rr][Ee] id = [?]*"; };
+struct G4 { static constexpr char const* value = "[!I]*"; };
+struct G5 { static constexpr char const* value = "*;"; };
+struct G6 { static constexpr char const* value = "*"; };
+struct G7 { static constexpr char const* value = "SELECT"; };
+struct G8 { static constexpr char const* value = "*id*id*"; };
+struct G9 { static constexpr char const* value = "*id*id*id*"; };
+
+struct Path    { static constexpr char const* value = "a*b[x]-c"; };
+struct Escaped { static constexpr char const* value = "a\\*b\\[x]-[a-c]"; };
+struct Range   { static constexpr char const* value = "[]a-]*"; };
+struct Bracket { static constexpr char const* value = "]x"; };
+
+} // namespace
+
+static_assert(  matches< Glob<G1>, Query >(),                                              "" );
+static_assert( !matches< Glob<G2>, Query >(),                                              "" );
+static_assert(  matches< Glob<G3>, Query >(),                                              "" );
+static_assert(  matches< Glob<G4>, Query >() && !matches< Glob<G4>, Insert >(),           "" );
+static_assert(  matches< Glob<G5>, Query >() && !matches< Glob<G5>, Select >(),           "" );
+static_assert(  matches< Glob<G6>, Query >() && matches< Glob<G6>, Empty >(),             "" );
+static_assert( !matches< Glob<G7>, Query >() && !matches< Glob<G7>, Select >(),           "" );
+static_assert(  matches< Glob<G8>, Query >() && !matches< Glob<G9>, Query >(),            "" );
+static_assert(  matches< Glob<Escaped>, Path >() && !matches< Glob<Path>, Path >(),       "" );
+static_assert(  matches< Glob<Range>, Bracket >() && !matches< Glob<Range>, Query >(),    "" );
+
+
+//     +--------------------------------+
+//     |  Failures show where it stops  |
+//     +--------------------------------+
+
+static_assert( st::detail::strMismatch_<st::detail::strEq_, Query, Select>::value == 7,     "" );
+static_assert( st::detail::strMismatch_<st::detail::startsWith_, Insert, Select>::value == 0, "" );
+static_assert( st::detail::strMismatch_<st::detail::endsWith_, Select, Semi>::value == 6,   "" );
+static_assert( st::detail::strMismatch_<st::detail::contains_, Query, Insert>::value == 40, "" );
+static_assert( st::detail::strMismatch_<st::detail::glob_, Query, G2>::value == 9,          "" );
+static_assert( std::is_same< st::detail::shown_<void, StrEq<Select>, Query>::type,
+                             st::detail::mismatch_<Query, 7> >::value,                      "" );
+
+
+#if ST_CONFIG_HAS_STRING_VIEW
+
+namespace {
+struct View { static constexpr std::string_view value = "SELECT id"; };
+}
+
+STATIC_EXPECT_THAT( View, StartsWith<Select> );
+STATIC_EXPECT_THAT( Query, StartsWith<View> );
+
+#endif
+
+
+#if ST_CONFIG_HAS_CLASS_NTTP
+
+STATIC_EXPECT_THAT( Query, StartsWith<string_c<"SELECT ">> );
+STATIC_EXPECT_THAT( Query, Glob<string_c<"SELECT * FROM [a-z]* WHERE *">> );
+STATIC_EXPECT_THAT( (string_c<"fmt: {}">), StrEq<string_c<"fmt: {}">> );
+
+#endif
+
+
+//     +----------------------+
+//     |  64K, in C++11 too   |
+//     +----------------------+
+
+namespace {
+
+#define ST_TEST_16_(s)  s s s s s s s s s s s s s s s s
+#define ST_TEST_64K_(s) ST_TEST_16_(ST_TEST_16_(ST_TEST_16_(s)))       // of 16 characters
+#define ST_TEST_A16_    "aaaaaaaaaaaaaaaa"
+#define ST_TEST_A400_   ST_TEST_16_(ST_TEST_A16_) ST_TEST_A16_ ST_TEST_A16_ ST_TEST_A16_ \
+                        ST_TEST_A16_ ST_TEST_A16_ ST_TEST_A16_ ST_TEST_A16_ ST_TEST_A16_ ST_TEST_A16_
+
+struct Large   { static constexpr char const* value = ST_TEST_64K_("abcdefghijklmnop") "!"; };
+struct Other   { static constexpr char const* value = ST_TEST_64K_("abcdefghijklmnop") "?"; };
+struct Tail    { static constexpr char const* value = "mnop!"; };
+struct Ends    { static constexpr char const* value = "abc*[m-p]!"; };
+
+// Contains at its worst: every place in the text matches all but the last character of the operand
+struct Long    { static constexpr char const* value = ST_TEST_64K_(ST_TEST_A16_) "b"; };
+struct Run     { static constexpr char const* value = ST_TEST_A400_ "b"; };
+struct Missing { static constexpr char const* value = ST_TEST_A400_ "c"; };
+
+#undef ST_TEST_A400_
+#undef ST_TEST_A16_
+#undef ST_TEST_64K_
+#undef ST_TEST_16_
+
+} // namespace
+
+static_assert(  matches< StrEq<Large>, Large >() && !matches< StrEq<Other>, Large >(),     "" );
+static_assert( st::detail::strMismatch_<st::detail::strEq_, Large, Other>::value == 65536,  "" );
+static_assert(  matches< StartsWith<Other>, Other >() && !matches< StartsWith<Large>, Other >(), "" );
+static_assert(  matches< EndsWith<Tail>, Large >() && !matches< EndsWith<Tail>, Other >(), "" );
+static_assert(  matches< Contains<Tail>, Large >() && !matches< Contains<Tail>, Other >(), "" );
+static_assert(  matches< Glob<Ends>, Large >() && !matches< Glob<Ends>, Other >(),         "" );
+
+STATIC_EXPECT_THAT( Long, Contains<Run> );
+STATIC_EXPECT_THAT( Long, Not<Contains<Missing>> );
+
+
+#if __cplusplus >= 201402L
+
+// Text computed by a constexpr function, as anything with data() and size()
+namespace {
+
+template<std::size_t N>
+struct Text {
+    char chars[N + 1];
+    constexpr char const* data() const { return chars; }
+    constexpr std::size_t size() const { return N; }
+};
+
+template<std::size_t N>
+constexpr Text<N> text( char last ) {
+    Text<N> t{};
+    for (std::size_t i = 0; i != N; ++i)
+        t.chars[i] = static_cast<char>('a' + i % 16);
+    t.chars[N - 1] = last;
+    return t;
+}
+
+struct Computed { static constexpr Text<65537> value = text<65537>('!'); };
+
+} // namespace
+
+static_assert(  matches< StrEq<Large>, Computed >() && matches< StrEq<Computed>, Large >(), "" );
+static_assert(  matches< Contains<Tail>, Computed >() && !matches< StrEq<Other>, Computed >(), "" );
+
+#endif
@@ -0,0 +1,18 @@
+#define ST_STATIC_EXPECT_CONFIG_STRUCTURED_MESSAGE 1
+
+#include <static_test/static_expect.hpp>
+
+#include <utility>
+
+using namespace st::static_matchers;
+
+// The record only shows up in failure messages; passing assertions must compile unchanged
+STATIC_EXPECT_THAT( int, Is<int> );
+STATIC_EXPECT_THAT( (std::pair<int, long>), char, (AllOf<Bind<IsNot<int>, 0>, Bind<Is<char>, 1>>) );
+STATIC_EXPECT_THAT_VALUE( sizeof(char), Eq<1> );
+
+template<class T>
+struct Templ {
+    STATIC_EXPECT_THAT_EXPR( T(), Is<T> );
+};
+template struct Templ<long>;
@@ -1,5 +1,6 @@
 #include <static_test/pp/misc.hpp>
 #include <static_test/pp/delay.hpp>
+#include <static_test/pp/variadic.hpp>
 
 #include <boost/preprocessor/cat.hpp>
 #include <boost/preprocessor/dec.hpp>
@@ -93,3 +94,38 @@ TEST( Preprocessor, DELAY ) {
 
 }
 
+
+//     +-----------------+
+//     |  VARIADIC_SIZE  |
+//     +-----------------+
+
+// What the attempts above were after
+static_assert(3 == ST_PP_VARIADIC_SIZE(a, b, c), "three arguments");
+static_assert(2 == ST_PP_VARIADIC_SIZE(a, b),    "two arguments");
+static_assert(1 == ST_PP_VARIADIC_SIZE(x),       "one argument");
+static_assert(0 == ST_PP_VARIADIC_SIZE(),        "no argument");
+static_assert(1 == ST_PP_VARIADIC_SIZE((a, b)),  "one parenthesized argument");
+static_assert(1 == ST_PP_VARIADIC_SIZE(()),      "one empty parenthesized argument");
+static_assert(63 == ST_PP_VARIADIC_SIZE(
+    0,1,2,3,4,5,6,7,8,9,0,1,2,3,4,5,6,7,8,9,0,1,2,3,4,5,6,7,8,9,0,1,
+    2,3,4,5,6,7,8,9,0,1,2,3,4,5,6,7,8,9,0,1,2,3,4,5,6,7,8,9,0,1,2), "the limit");
+
+
+//     +-------------+
+//     |  STRINGIZE  |
+//     +-------------+
+
+TEST( Preprocessor, STRINGIZE ) {
+    EXPECT_STREQ( "a", ST_PP_STRINGIZE(a) );
+    EXPECT_STREQ( "", ST_PP_STRINGIZE() );
+
+    // arguments are expanded before stringizing
+    #define ST_TEST_ARG pair<int,double>
+    EXPECT_STREQ( "pair<int,double>", ST_PP_STRINGIZE(ST_TEST_ARG) );
+    #undef ST_TEST_ARG
+
+    // the same on either path, whatever the spacing around the commas
+    EXPECT_STREQ( "a,b,c", ST_PP_STRINGIZE(a, b,c) );
+    EXPECT_STREQ( "a,b c,(d, e)", ST_PP_STRINGIZE( a ,  b   c,(d, e) ) );
+    EXPECT_STREQ( "a,b,c", ST_PP_STRINGIZE_R(1, a, b ,c) );
+}
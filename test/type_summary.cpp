@@ -0,0 +1,63 @@
+#define ST_STATIC_EXPECT_CONFIG_TYPE_SUMMARY 1
+
+#include <static_test/static_expect.hpp>
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+using st::detail::summarize;
+using st::detail::tpl_;
+using st::detail::more_;
+using st::detail::t_;
+
+namespace {
+
+template<class T, int Depth, int Width, class Expected>
+constexpr bool summarizes_to() { return std::is_same< t_<summarize<T, Depth, Width>>, Expected >::value; }
+
+template<class... T> struct many {};
+template<class T, int N> struct nttp {};
+
+} // namespace
+
+//     +-------------------------+
+//     |  Small types unchanged  |
+//     +-------------------------+
+
+static_assert( summarizes_to< int, 0, 0, int >(),                                            "" );
+static_assert( summarizes_to< std::pair<int, long>, 1, 2, std::pair<int, long> >(),          "" );
+static_assert( summarizes_to< many<>, 0, 0, many<> >(),                                      "" );
+static_assert( summarizes_to< nttp<many<int>, 3>, 0, 0, nttp<many<int>, 3> >(),              "nttp" );
+
+
+//     +---------+
+//     |  Width  |
+//     +---------+
+
+static_assert( summarizes_to< many<int, char, long>, 1, 2,
+                              tpl_<many, int, char, more_<1>> >(),                            "" );
+static_assert( summarizes_to< many<int, char, long>, 1, 3, many<int, char, long> >(),        "" );
+static_assert( summarizes_to< many<int, char, long>, 1, 0, tpl_<many, more_<3>> >(),         "" );
+
+
+//     +---------+
+//     |  Depth  |
+//     +---------+
+
+static_assert( summarizes_to< many<int>, 0, 4, tpl_<many, more_<1>> >(),                    "" );
+static_assert( summarizes_to< many<many<many<int>>>, 2, 4,
+                              many<many<tpl_<many, more_<1>>>> >(),                           "" );
+
+// Both limits, as in config.hpp
+static_assert( summarizes_to< std::tuple<std::pair<int, long>, char, float>, 1, 2,
+                              tpl_<std::tuple, tpl_<std::pair, more_<2>>, char, more_<1>> >(), "" );
+
+// Compound types are looked through
+static_assert( summarizes_to< many<int, long> const*&, 0, 4,
+                              tpl_<many, more_<2>> const*& >(),                              "" );
+
+
+// Passing assertions never evaluate the summary
+STATIC_EXPECT_THAT( (many<many<many<many<int>>>, char, long, short, float>),
+                    (st::static_matchers::Is<many<many<many<many<int>>>, char, long, short, float>>) );
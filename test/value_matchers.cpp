@@ -0,0 +1,94 @@
+#include <static_test/static_expect.hpp>
+
+#include <climits>
+#include <cstddef>
+#include <type_traits>
+
+using namespace st::static_matchers;
+
+namespace {
+
+template<class M, class... T>
+constexpr bool matches() { return st::detail::InvokeMatcher<M, T...>::value; }
+
+template<class V, V N> using c = std::integral_constant<V, N>;
+
+enum class Level : unsigned char { low, mid, high };
+
+} // namespace
+
+//     +---------------+
+//     |  Comparisons  |
+//     +---------------+
+
+static_assert(  matches< Eq<3>, c<int, 3> >(),                                             "" );
+static_assert( !matches< Ne<3>, c<int, 3> >(),                                             "" );
+static_assert(  matches< Ne<4>, c<int, 3> >(),                                             "" );
+static_assert(  matches< Lt<4>, c<int, 3> >() && !matches< Lt<3>, c<int, 3> >(),         "" );
+static_assert(  matches< Le<3>, c<int, 3> >() && !matches< Le<2>, c<int, 3> >(),         "" );
+static_assert(  matches< Gt<2>, c<int, 3> >() && !matches< Gt<3>, c<int, 3> >(),         "" );
+static_assert(  matches< Ge<3>, c<int, 3> >() && !matches< Ge<4>, c<int, 3> >(),         "" );
+static_assert(  matches< Between<3, 3>, c<int, 3> >(),                                     "" );
+static_assert( !matches< Between<4, 9>, c<int, 3> >(),                                     "" );
+static_assert( !matches< Between<0, 2>, c<int, 3> >(),                                     "" );
+
+// Same as Between
+static_assert(  matches< InRange<0, 9>, c<int, 3> >(),                                     "" );
+
+
+//     +-------------------------------------+
+//     |  Bounds of any type (C++11 forms)   |
+//     +-------------------------------------+
+
+// Beyond int
+static_assert(  matches< Gt_c<std::size_t, std::size_t(INT_MAX) + 1>, c<std::size_t, std::size_t(-1)> >(), "" );
+static_assert(  matches< Eq_c<unsigned long long, ULLONG_MAX>, c<unsigned long long, ULLONG_MAX> >(), "" );
+static_assert(  matches< Lt_c<long long, LLONG_MIN + 1>, c<long long, LLONG_MIN> >(),     "" );
+static_assert(  matches< Between_c<char, 'a', 'z'>, c<char, 'q'> >(),                     "" );
+static_assert(  matches< Eq_c<bool, true>, std::true_type >(),                             "" );
+static_assert(  matches< Ge_c<Level, Level::mid>, c<Level, Level::high> >(),               "" );
+static_assert( !matches< Ge_c<Level, Level::mid>, c<Level, Level::low> >(),                "" );
+
+// Integers compare by value, whatever their signedness
+static_assert( !matches< Lt_c<int, 0>, c<unsigned, UINT_MAX> >(),                          "" );
+static_assert(  matches< Gt_c<int, -1>, c<unsigned, 0> >(),                                "" );
+static_assert( !matches< Eq_c<int, -1>, c<unsigned, UINT_MAX> >(),                         "" );
+static_assert(  matches< Lt_c<unsigned, 0>, c<int, -1> >(),                                "" );
+static_assert( !matches< Eq_c<unsigned, UINT_MAX>, c<int, -1> >(),                         "" );
+static_assert(  matches< Between_c<long, -1, 1>, c<std::size_t, 0> >(),                    "" );
+static_assert( !matches< Between_c<long, -1, 1>, c<std::size_t, std::size_t(-1)> >(),             "" );
+
+#if ST_CONFIG_HAS_AUTO_NTTP
+
+// The short forms keep the type of the bound
+static_assert( std::is_same< Lt<std::size_t(1)>, Lt_c<std::size_t, 1> >::value,           "" );
+static_assert( std::is_same< Between<'a', 'z'>, Between_c<char, 'a', 'z'> >::value,        "" );
+static_assert(  matches< Gt<std::size_t(INT_MAX) + 1>, c<std::size_t, std::size_t(-1)> >(),       "" );
+static_assert(  matches< Ne<Level::low>, c<Level, Level::mid> >(),                         "" );
+static_assert( !matches< Lt<0>, c<unsigned, UINT_MAX> >(),                                 "" );
+
+STATIC_EXPECT_THAT_VALUE( sizeof(long long), Ge<8u> );
+STATIC_EXPECT_THAT_VALUE( Level::high, Gt<Level::mid> );
+
+#endif
+
+STATIC_EXPECT_THAT( (c<std::size_t, std::size_t(-1)>), (Gt_c<std::size_t, std::size_t(INT_MAX) + 1>) );
+STATIC_EXPECT_THAT( (std::extent<int[5]>), (AllOf<Ge<1>, Le<8>, Ne<3>>) );
+
+
+//     +---------------------------+
+//     |  Failures show the value  |
+//     +---------------------------+
+
+static_assert( std::is_same< Eq_c<long, 5>::show<std::extent<int[5]>>,
+                             st::detail::value_<std::extent<int[5]>, std::size_t, 5> >::value, "" );
+static_assert( std::is_same< Between<0, 1>::show<c<Level, Level::mid>>,
+                             st::detail::value_<c<Level, Level::mid>, Level, Level::mid> >::value, "" );
+static_assert( std::is_same< st::detail::shown_<void, Lt<0>, c<int, 7>>::type,
+                             st::detail::value_<c<int, 7>, int, 7> >::value,                "" );
+static_assert( std::is_same< st::detail::shown_<void, AllOf<Lt<5>, Ne<4>>, c<int, 4>>::type,
+                             st::detail::value_<c<int, 4>, int, 4> >::value,                "" );
+static_assert( std::is_same< st::detail::shown_<void, Not<Between<0, 9>>, c<int, 4>>::type,
+                             st::detail::value_<c<int, 4>, int, 4> >::value,                "" );
+static_assert( std::is_same< st::detail::shown_<void, AnyOf<Is<int>, Gt<8>>, c<long, 2>>::type,
+                             st::detail::value_<c<long, 2>, long, 2> >::value,              "" );
@@ -0,0 +1,462 @@
+#!/usr/bin/env python3
+#
+#  @copyright S. Levent Yilmaz 2016
+#  Distributed under the Boost Software License, Version 1.0.
+#  See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt.
+#
+"""Generate the single header edition of static_test: one self-contained static_test.hpp.
+
+The library headers under --source-dir, starting from static_test/static_expect.hpp and
+static_test/runtime_expect.hpp, are inlined in include order, each once. So are the
+Boost.Preprocessor headers they include, found on the -I paths, with every BOOST_PP_* macro
+renamed ST_BPP_*, so that the copy can't clash with whatever Boost.Preprocessor the including
+code uses. All the conditional branches are kept (the compiler specific EDG, MSVC.. workarounds
+among them), so the output is as portable as the sources. The other includes, the standard
+library's, stay includes; the library may include nothing else of Boost, so that the output
+needs no Boost at all.
+
+Comments are stripped, continued lines spliced and blank lines dropped. So are the definitions
+of the vendored macros that nothing uses: a macro is kept when its name, or a prefix of it (for
+the names pasted together with ##, as in BOOST_PP_CAT(BOOST_PP_FOR_, n)), appears in the library,
+in a preprocessor condition, or in a kept macro. --keep-macros keeps them all. What is left of a
+vendored header none of whose macros are kept, its include guard and empty conditionals, goes too.
+
+With --pp-config, only the branches of the given Boost.Preprocessor configuration are kept
+where the choice is BOOST_PP_CONFIG_FLAGS(): STRICT for GCC, Clang and the conforming MSVC
+preprocessor, MSVC for the traditional one, and so on. The output is then about half the size,
+and fails to compile (#error) under any other configuration.
+
+With --forwarding-headers, every library header also gets a stand-in next to the output, in
+static_test/, which includes static_test.hpp; with that directory first on the include path,
+code written against the separate headers, the tests among them, builds against the single one.
+"""
+
+import argparse
+import bisect
+import os
+import re
+import sys
+
+ENTRY_POINTS = ['static_test/static_expect.hpp', 'static_test/runtime_expect.hpp']
+HEADER_EXTS = ('.hpp', '.h')
+
+VENDORED_PREFIX = 'ST_BPP_'
+RENAMES = [(re.compile(r'BOOST_PP_'), VENDORED_PREFIX),
+           (re.compile(r'BOOST_PREPROCESSOR_'), 'ST_BPP_HEADER_')]
+
+# Comments are replaced by a space; literals are matched so as to be left alone
+COMMENT_OR_LITERAL = re.compile(r'//[^\n]*|/\*.*?\*/|"(?:\\.|[^"\\\n])*"|\'(?:\\.|[^\'\\\n])*\'', re.S)
+INCLUDE = re.compile(r'^\s*#\s*include\s*([<"])([^>"]+)[>"]')
+DIRECTIVE = re.compile(r'^\s*#\s*(\w+)\s*(.*)$')
+DEFINE = re.compile(r'^\s*#\s*define\s+(\w+)')
+IDENTIFIER = re.compile(r'[A-Za-z_]\w*')
+
+BANNER = '''\
+/**
+  static_test, single header edition.
+
+  @copyright S. Levent Yilmaz 2016
+  Distributed under the Boost Software License, Version 1.0.
+  See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt.
+
+  Generated by tools/amalgamate.py; do not edit. Contains parts of Boost.Preprocessor (Copyright
+  Paul Mensonides 2002-2011, Housemarque Oy 2002, Edward Diener 2011-2020; Boost Software License,
+  Version 1.0), with the BOOST_PP_ macros renamed ST_BPP_.
+*/
+#pragma once
+'''
+
+
+#     +-----------+
+#     |  Sources  |
+#     +-----------+
+
+def strip(m):
+    s = m.group(0)
+    return ' ' if s.startswith('/') else s
+
+
+def squeeze(line):
+    """Runs of blanks outside of literals as one space"""
+    out, pos = [], 0
+    for m in re.finditer(r'"(?:\\.|[^"\\])*"|\'(?:\\.|[^\'\\])*\'', line):
+        out.append(re.sub(r'[ \t]+', ' ', line[pos:m.start()]))
+        out.append(m.group(0))
+        pos = m.end()
+    out.append(re.sub(r'[ \t]+', ' ', line[pos:]))
+    return ''.join(out).strip()
+
+
+def logical_lines(path):
+    """The lines of a source file, spliced, without comments, blank lines dropped"""
+    with open(path, encoding='utf-8') as f:
+        src = f.read().replace('\r\n', '\n')
+    src = src.replace('\\\n', '')
+    src = COMMENT_OR_LITERAL.sub(strip, src)
+    # null directives (a lone #) go too
+    return [l for l in (squeeze(l) for l in src.split('\n')) if l and l != '#']
+
+
+def directive(line):
+    m = DIRECTIVE.match(line)
+    return (m.group(1), m.group(2).strip()) if m else (None, None)
+
+
+def guard(lines):
+    """Indices of the include guard's #ifndef and #endif, if the file has one"""
+    dirs = [(i, directive(l)) for i, l in enumerate(lines) if l.startswith('#')]
+    if len(dirs) >= 3 and dirs[0][1][0] == 'ifndef' and dirs[1][1] == ('define', dirs[0][1][1]) \
+            and dirs[-1][1][0] == 'endif':
+        return dirs[0][0], dirs[-1][0]
+    return None
+
+
+#     +------------+
+#     |  Branches  |
+#     +------------+
+
+PP_CONFIGS = {'STRICT': 0x01, 'IDEAL': 0x02, 'MSVC': 0x04, 'MWCC': 0x08, 'BCC': 0x10, 'EDG': 0x20,
+              'DMC': 0x40}
+PP_CONFIG_FLAG = re.compile(r'BOOST_PP_CONFIG_(\w+)\(\)')
+DECIDABLE = re.compile(r'^[\s\d()~&|!]*$')
+
+
+def decide(cond, flags):
+    """The value of a condition on BOOST_PP_CONFIG_FLAGS() alone, or None"""
+    if 'BOOST_PP_CONFIG_FLAGS()' not in cond:
+        return None
+    cond = cond.replace('BOOST_PP_CONFIG_FLAGS()', str(flags))
+    cond = PP_CONFIG_FLAG.sub(lambda m: str(PP_CONFIGS.get(m.group(1), 'x')), cond)
+    if not DECIDABLE.match(cond):
+        return None
+    cond = re.sub(r'!(?!=)', ' not ', cond.replace('&&', ' and ').replace('||', ' or '))
+    return bool(eval(cond, {'__builtins__': {}}))
+
+
+def select(lines, flags):
+    """The lines, with the #if chains on the configuration flags resolved"""
+    out, frames = [], []    # frames: [decided, active, taken]
+
+    def active(frames):
+        return all(f[1] for f in frames)
+
+    for line in lines:
+        kind, cond = directive(line)
+        if kind in ('if', 'ifdef', 'ifndef'):
+            v = decide(cond, flags) if kind == 'if' else None
+            if v is None and active(frames):
+                out.append(line)
+            frames.append([v is not None, v is not False, bool(v)])
+        elif kind == 'elif':
+            f = frames[-1]
+            if not f[0]:
+                if active(frames[:-1]):
+                    out.append(line)
+                continue
+            v = None if f[2] else decide(cond, flags)
+            if f[2]:
+                f[1] = False
+            elif v is None:
+                # the rest of the chain is up to the compiler
+                f[0], f[1] = False, True
+                if active(frames[:-1]):
+                    out.append('#if ' + cond)
+            else:
+                f[1] = f[2] = v
+        elif kind == 'else':
+            f = frames[-1]
+            if f[0]:
+                f[1], f[2] = not f[2], True
+            elif active(frames[:-1]):
+                out.append(line)
+        elif kind == 'endif':
+            f = frames.pop()
+            if not f[0] and active(frames):
+                out.append(line)
+        elif active(frames):
+            out.append(line)
+    return out
+
+
+#     +------------+
+#     |  Inlining  |
+#     +------------+
+
+class Amalgamation:
+    def __init__(self, source_dir, include_dirs, pp_config=None):
+        self.source_dir = source_dir
+        self.include_dirs = include_dirs
+        self.pp_config = pp_config
+        self.lines = []         # (line, vendored)
+        self.inlined = set()    # the library headers inlined so far
+        self.prologue = []      # the vendored headers the library includes
+
+    def find(self, name, includer, quoted):
+        """(path, vendored) of an included header, or None if it stays an include"""
+        if quoted:
+            path = os.path.join(os.path.dirname(includer), name)
+            if os.path.isfile(path):
+                return os.path.realpath(path), includer_vendored(includer, self.source_dir)
+        if name.startswith('static_test/'):
+            return os.path.realpath(os.path.join(self.source_dir, name)), False
+        if name.startswith('boost/preprocessor'):
+            for d in self.include_dirs:
+                path = os.path.join(d, name)
+                if os.path.isfile(path):
+                    return os.path.realpath(path), True
+            raise SystemExit('amalgamate: <%s> not found on the include path' % name)
+        if name.startswith('boost/') and not includer_vendored(includer, self.source_dir):
+            raise SystemExit('amalgamate: %s includes <%s>; of Boost, the single header can only '
+                             'contain Boost.Preprocessor' % (os.path.relpath(includer, self.source_dir), name))
+        return None
+
+    def sites(self, path, vendored):
+        """Generate (line, included header or None, conditional) for the lines of a header"""
+        lines = logical_lines(path)
+        if vendored and self.pp_config:
+            lines = select(lines, PP_CONFIGS[self.pp_config])
+        g = guard(lines) if vendored else None
+        depth = 0
+        for i, line in enumerate(lines):
+            kind, _ = directive(line)
+            if kind == 'pragma' and line.split()[-1] == 'once':
+                continue
+            if not (g and i in g):
+                depth += {'if': 1, 'ifdef': 1, 'ifndef': 1, 'endif': -1}.get(kind, 0)
+            m = INCLUDE.match(line)
+            found = m and self.find(m.group(2), path, m.group(1) == '"')
+            yield line, found, depth != 0
+
+    def add(self, path):
+        """Inline a library header. The Boost.Preprocessor ones it includes are left for vendor()."""
+        for line, found, _ in self.sites(path, False):
+            if not found:
+                self.lines.append((line, False))
+                continue
+            header, vendored = found
+            if vendored:
+                if header not in self.prologue:
+                    self.prologue.append(header)
+            elif header not in self.inlined:
+                self.inlined.add(header)
+                self.add(header)
+
+    def vendor(self):
+        """Inline the Boost.Preprocessor headers, ahead of the library.
+
+        Those that every configuration includes go once each, those they include first; the
+        others (the compiler specific variants) stay where they are included, under the same
+        conditions. Whatever the conditions in the library, all it includes is vendored: none of
+        it depends on the library's own configuration."""
+        graph, todo = {}, list(self.prologue)
+        while todo:
+            h = todo.pop()
+            if h not in graph:
+                graph[h] = [(x[0], c) for _, x, c in self.sites(h, True) if x]
+                todo += [x for x, _ in graph[h]]
+
+        always, todo = set(), list(self.prologue)
+        while todo:
+            h = todo.pop()
+            if h not in always:
+                always.add(h)
+                todo += [x for x, c in graph[h] if not c]
+
+        order, seen = [], set()
+
+        def visit(h):
+            if h not in seen:
+                seen.add(h)
+                for x, _ in graph[h]:
+                    visit(x)
+                if h in always:
+                    order.append(h)
+        for h in self.prologue:
+            visit(h)
+
+        library, self.lines = self.lines, []
+        for h in order:
+            self.add_vendored(h, always, [h])
+        if self.pp_config:
+            self.lines += [(l, True) for l in (
+                '#if BOOST_PP_CONFIG_FLAGS() != %d' % PP_CONFIGS[self.pp_config],
+                '#error "static_test.hpp: generated for the %s configuration of Boost.Preprocessor '
+                'only (see tools/amalgamate.py --pp-config)"' % self.pp_config,
+                '#endif')]
+        self.lines += library
+
+    def add_vendored(self, path, always, open_):
+        for line, found, _ in self.sites(path, True):
+            if not found:
+                self.lines.append((line, True))
+            elif found[0] not in always and found[0] not in open_:
+                self.add_vendored(found[0], always, open_ + [found[0]])
+
+    def text(self, keep_macros):
+        lines = [(rename(l), v) for l, v in self.lines]
+        missing = undefined(lines)
+        if missing:
+            raise SystemExit('amalgamate: the library uses %s, which none of the Boost.Preprocessor '
+                             'headers it includes define'
+                             % ', '.join(sorted(m.replace(VENDORED_PREFIX, 'BOOST_PP_') for m in missing)))
+        if not keep_macros:
+            lines = prune(lines)
+        return BANNER + ''.join(l + '\n' for l, _ in lines)
+
+
+def includer_vendored(path, source_dir):
+    return not os.path.realpath(path).startswith(os.path.realpath(source_dir) + os.sep)
+
+
+def rename(line):
+    for pattern, to in RENAMES:
+        line = pattern.sub(to, line)
+    return line
+
+
+#     +-----------+
+#     |  Pruning  |
+#     +-----------+
+
+def identifiers(line):
+    return set(IDENTIFIER.findall(COMMENT_OR_LITERAL.sub(' ', line)))
+
+
+def undefined(lines):
+    """The vendored macros the library uses, but doesn't get from its Boost.Preprocessor includes
+    (which it still compiles with, as long as some other header includes them first)"""
+    defined = {m.group(1) for m in (DEFINE.match(l) for l, v in lines if v) if m}
+    used = set()
+    for line, vendored in lines:
+        if not vendored:
+            used |= {x for x in identifiers(line) if x.startswith(VENDORED_PREFIX)}
+    return used - defined
+
+
+def prune(lines):
+    """Drop the definitions of vendored macros that nothing uses"""
+    defined = {}
+    for i, (line, vendored) in enumerate(lines):
+        m = DEFINE.match(line)
+        if vendored and m:
+            defined.setdefault(m.group(1), []).append(i)
+    names = sorted(defined)
+
+    used, todo = set(), set()
+    for i, (line, vendored) in enumerate(lines):
+        kind, _ = directive(line)
+        if not vendored or (kind != 'define' and kind != 'undef'):
+            todo |= identifiers(line)
+    while todo:
+        name = todo.pop()
+        # the macro it names, or the vendored ones it begins the name of
+        lo = bisect.bisect_left(names, name)
+        hi = lo + 1 if lo < len(names) and names[lo] == name else lo
+        if name.startswith(VENDORED_PREFIX):
+            while hi < len(names) and names[hi].startswith(name):
+                hi += 1
+        for macro in names[lo:hi]:
+            if macro not in used:
+                used.add(macro)
+                for i in defined[macro]:
+                    line = lines[i][0]
+                    todo |= identifiers(line[DEFINE.match(line).end():]) - used
+    dropped = {i for macro, at in defined.items() if macro not in used for i in at}
+    return empty_groups_dropped([x for i, x in enumerate(lines) if i not in dropped])
+
+
+def empty_groups_dropped(lines):
+    """Drop the vendored conditional groups left with nothing in them, include guards among them,
+    innermost first: what remains of the headers none of whose macros are used"""
+    while True:
+        dropped, stack = set(), []
+        for i, (line, vendored) in enumerate(lines):
+            kind, rest = directive(line)
+            if not vendored or kind is None:
+                if stack:
+                    stack[-1][1] = False
+            elif kind in ('if', 'ifdef', 'ifndef'):
+                stack.append([i, True, rest if kind == 'ifndef' else None])
+            elif kind in ('elif', 'else'):
+                pass
+            elif kind == 'endif':
+                start, empty, guarded = stack.pop()
+                if empty:
+                    dropped |= set(range(start, i + 1))
+                elif stack:
+                    stack[-1][1] = False
+            elif stack and not (kind == 'define' and rest == stack[-1][2] and i == stack[-1][0] + 1):
+                stack[-1][1] = False
+        if not dropped:
+            return lines
+        lines = [x for i, x in enumerate(lines) if i not in dropped]
+
+
+#     +----------+
+#     |  Output  |
+#     +----------+
+
+def library_headers(source_dir):
+    root = os.path.join(source_dir, 'static_test')
+    for d, _, files in os.walk(root):
+        for f in sorted(files):
+            if f.endswith(HEADER_EXTS):
+                yield os.path.relpath(os.path.join(d, f), source_dir)
+
+
+def write_forwarding_headers(source_dir, output):
+    out_dir = os.path.dirname(os.path.abspath(output))
+    for rel in library_headers(source_dir):
+        path = os.path.join(out_dir, rel)
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+        target = os.path.relpath(os.path.abspath(output), os.path.dirname(path))
+        write_if_changed(path, '// Generated by tools/amalgamate.py: the library is all in %s\n'
+                               '#pragma once\n#include "%s"\n'
+                               % (os.path.basename(output), target.replace(os.sep, '/')))
+
+
+def write_if_changed(path, text):
+    """Leave the file alone if it's up to date, so that what includes it isn't rebuilt"""
+    try:
+        with open(path, encoding='utf-8') as f:
+            if f.read() == text:
+                return
+    except OSError:
+        pass
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(text)
+
+
+def main():
+    p = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    p.add_argument('--source-dir', required=True, help='the directory static_test/ is in')
+    p.add_argument('--output', '-o', required=True, help='the header to write')
+    p.add_argument('-I', dest='includes', action='append', default=[],
+                   help='where to find Boost.Preprocessor (repeatable)')
+    p.add_argument('--keep-macros', action='store_true',
+                   help="keep the definitions of the vendored macros nothing uses")
+    p.add_argument('--pp-config', choices=sorted(PP_CONFIGS),
+                   help='keep only the branches of this Boost.Preprocessor configuration')
+    p.add_argument('--forwarding-headers', action='store_true',
+                   help='write a stand-in for every library header next to the output')
+    opts = p.parse_args()
+
+    source_dir = os.path.abspath(opts.source_dir)
+    a = Amalgamation(source_dir, [os.path.abspath(i) for i in opts.includes], opts.pp_config)
+    for entry in ENTRY_POINTS:
+        path = os.path.realpath(os.path.join(source_dir, entry))
+        if path not in a.inlined:
+            a.inlined.add(path)
+            a.add(path)
+    a.vendor()
+
+    out_dir = os.path.dirname(os.path.abspath(opts.output))
+    os.makedirs(out_dir, exist_ok=True)
+    write_if_changed(opts.output, a.text(opts.keep_macros))
+    if opts.forwarding_headers:
+        write_forwarding_headers(source_dir, opts.output)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
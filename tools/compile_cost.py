@@ -0,0 +1,256 @@
+#!/usr/bin/env python3
+#
+#  @copyright S. Levent Yilmaz 2016
+#  Distributed under the Boost Software License, Version 1.0.
+#  See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt.
+#
+"""Compile-cost tracker for the static test suite.
+
+Re-runs the compile command of every test translation unit (taken from CMake's
+compile_commands.json) and measures, per TU:
+
+  time_ms          wall clock time of the compiler process (minimum over --repeat runs)
+  peak_rss_kb      peak resident memory of the compiler process
+  instantiations   number of template specializations (GCC: the decl_ and type_specializations
+                   of -fmem-report, Clang: the Total Instantiate* events of -ftime-trace)
+  instantiation_ms time spent instantiating templates (GCC: -ftime-report, Clang: -ftime-trace)
+
+`record` writes the measurements to a baseline file meant to be committed along with the tests.
+`check` measures again and compares against the baseline, reporting every metric that grew by
+more than the threshold, and every TU missing from the baseline (record it along with the new TU).
+With --fail the exit code is non-zero on either, otherwise they are only reported as warnings.
+
+Only the metrics that repeat from run to run, instantiations and peak_rss_kb, fail a check: times
+differ from machine to machine, and run to run, by more than any useful threshold, so time_ms and
+instantiation_ms regressions are always warnings, to be confirmed by hand. Counts from GCC and
+Clang are not comparable; record the baseline with the compiler that checks against it.
+"""
+
+import argparse
+import json
+import os
+import re
+import shlex
+import subprocess
+import sys
+import tempfile
+import time
+
+METRICS = ('time_ms', 'peak_rss_kb', 'instantiations', 'instantiation_ms')
+GATED = ('peak_rss_kb', 'instantiations')
+
+
+#     +-------------------+
+#     |  Compile command  |
+#     +-------------------+
+
+def load_commands(compile_commands, target, source_dir):
+    """Compile commands of the given CMake target, for sources within source_dir."""
+    with open(compile_commands) as f:
+        entries = json.load(f)
+    source_dir = os.path.realpath(source_dir)
+    marker = '/' + target + '.dir/'
+    result = []
+    for e in entries:
+        args = e['arguments'] if 'arguments' in e else shlex.split(e['command'])
+        src = os.path.realpath(os.path.join(e['directory'], e['file']))
+        if not src.startswith(source_dir + os.sep):
+            continue
+        if target and not any(marker in a for a in args):
+            continue
+        result.append((os.path.relpath(src, source_dir), e['directory'], args))
+    return sorted(result)
+
+
+def compiler_kind(compiler):
+    out = subprocess.run([compiler, '--version'], stdout=subprocess.PIPE,
+                         stderr=subprocess.STDOUT, universal_newlines=True).stdout
+    first = out.splitlines()[0] if out else compiler
+    return ('clang' if 'clang' in out.lower() else 'gcc'), first.strip()
+
+
+def with_output(args, output):
+    """Replace the `-o <file>` of a compile command."""
+    args = list(args)
+    for i, a in enumerate(args):
+        if a == '-o' and i + 1 < len(args):
+            args[i + 1] = output
+            return args
+    return args + ['-o', output]
+
+
+#     +---------------+
+#     |  Measurement  |
+#     +---------------+
+
+def run_measured(args, cwd):
+    """Run a command, return (returncode, stderr, wall-ms, peak-rss-kb) of the child."""
+    err = tempfile.TemporaryFile(mode='w+')
+    start = time.perf_counter()
+    proc = subprocess.Popen(args, cwd=cwd, stdout=subprocess.DEVNULL, stderr=err)
+    _, status, usage = os.wait4(proc.pid, 0)
+    elapsed = (time.perf_counter() - start) * 1000.0
+    proc.returncode = os.waitstatus_to_exitcode(status)
+    err.seek(0)
+    return proc.returncode, err.read(), elapsed, usage.ru_maxrss
+
+
+# GCC -ftime-report line, e.g.
+#  template instantiation             :   0.02 ( 11%)   0.00 (  0%)   0.03 ( 12%)  2345k (  9%)
+GCC_PHASE = re.compile(r'^\s*template instantiation\s*:\s*([\d.]+)\s*\(\s*\d+%\)\s*([\d.]+)'
+                       r'\s*\(\s*\d+%\)\s*([\d.]+)')
+
+
+# GCC -fmem-report lines, of the specializations of function and variable, and of class templates
+#  decl_specializations: size 1021, 551 elements, 2.005758 collisions
+GCC_SPECIALIZATIONS = re.compile(r'^\s*(?:decl|type)_specializations: size \d+, (\d+) elements')
+
+
+def gcc_instantiation_ms(report):
+    for line in report.splitlines():
+        m = GCC_PHASE.match(line)
+        if m:
+            return round(float(m.group(3)) * 1000.0, 1)
+    return None
+
+
+def gcc_instantiations(report):
+    counts = [int(m.group(1)) for m in map(GCC_SPECIALIZATIONS.match, report.splitlines()) if m]
+    return sum(counts) if counts else None
+
+
+def clang_instantiations(trace_file):
+    """Sum the `Total Instantiate*` summary events of a Clang -ftime-trace file."""
+    try:
+        with open(trace_file) as f:
+            events = json.load(f).get('traceEvents', [])
+    except (OSError, ValueError):
+        return None, None
+    count, dur = 0, 0.0
+    for ev in events:
+        if ev.get('name') in ('Total InstantiateClass', 'Total InstantiateFunction'):
+            count += int(ev.get('args', {}).get('count', 0))
+            dur += float(ev.get('dur', 0)) / 1000.0
+    return count, round(dur, 1)
+
+
+def measure(tu, cwd, args, kind, repeat):
+    with tempfile.TemporaryDirectory() as tmp:
+        obj = os.path.join(tmp, 'tu.o')
+        cmd = with_output(args, obj)
+        cmd += ['-ftime-trace'] if kind == 'clang' else ['-ftime-report', '-fmem-report']
+        best = None
+        for _ in range(repeat):
+            rc, err, ms, rss = run_measured(cmd, cwd)
+            if rc != 0:
+                sys.stderr.write(err)
+                raise SystemExit('compile_cost: failed to compile ' + tu)
+            if best is None or ms < best['time_ms']:
+                best = {'time_ms': round(ms, 1), 'peak_rss_kb': rss}
+                if kind == 'clang':
+                    n, n_ms = clang_instantiations(os.path.splitext(obj)[0] + '.json')
+                else:
+                    n, n_ms = gcc_instantiations(err), gcc_instantiation_ms(err)
+                best['instantiations'] = n
+                best['instantiation_ms'] = n_ms
+        return best
+
+
+def measure_all(opts):
+    commands = load_commands(opts.compile_commands, opts.target, opts.source_dir)
+    if not commands:
+        raise SystemExit('compile_cost: no compile commands found for target ' + opts.target)
+    kind, version = compiler_kind(commands[0][2][0])
+    files = {}
+    for tu, cwd, args in commands:
+        files[tu] = measure(tu, cwd, args, kind, opts.repeat)
+    return {'compiler': version, 'files': files}
+
+
+#     +------------+
+#     |  Commands  |
+#     +------------+
+
+def record(opts):
+    result = measure_all(opts)
+    with open(opts.baseline, 'w') as f:
+        json.dump(result, f, indent=2, sort_keys=True)
+        f.write('\n')
+    print_table(result['files'], None)
+    print('compile_cost: baseline written to ' + opts.baseline)
+    return 0
+
+
+def check(opts):
+    with open(opts.baseline) as f:
+        baseline = json.load(f)
+    result = measure_all(opts)
+    if baseline.get('compiler') != result['compiler']:
+        print('compile_cost: warning: baseline was recorded with "%s", measuring with "%s"'
+              % (baseline.get('compiler'), result['compiler']))
+
+    regressions, missing = [], []
+    for tu, now in sorted(result['files'].items()):
+        was = baseline['files'].get(tu)
+        if was is None:
+            missing.append(tu)
+            continue
+        for metric in METRICS:
+            if was.get(metric) is None or now.get(metric) is None:
+                continue
+            limit = was[metric] * (1.0 + opts.threshold / 100.0)
+            if metric.endswith('_ms'):
+                limit += opts.slack_ms   # absorb timer noise on tiny TUs
+            if now[metric] > limit:
+                regressions.append((tu, metric, was[metric], now[metric]))
+
+    print_table(result['files'], baseline['files'])
+    failed = bool(missing)
+    for tu, metric, was, now in regressions:
+        gated = metric in GATED
+        failed = failed or gated
+        print('compile_cost: %s: %s: %s %s -> %s (+%.0f%%, threshold %g%%)%s'
+              % ('error' if opts.fail and gated else 'warning', tu, metric, was, now,
+                 100.0 * (now - was) / was if was else float('inf'), opts.threshold,
+                 '' if gated else ', timing only'))
+    for tu in missing:
+        print('compile_cost: %s: %s has no baseline (re-record it with `record`)'
+              % ('error' if opts.fail else 'warning', tu))
+    if not regressions:
+        print('compile_cost: no regressions above %g%%' % opts.threshold)
+    return 1 if failed and opts.fail else 0
+
+
+def print_table(files, baseline):
+    head = '%-32s %10s %12s %8s %10s' % ('TU', 'time_ms', 'peak_rss_kb', 'inst', 'inst_ms')
+    print(head)
+    print('-' * len(head))
+    for tu, m in sorted(files.items()):
+        print('%-32s %10s %12s %8s %10s' % (tu, m['time_ms'], m['peak_rss_kb'],
+                                            '-' if m['instantiations'] is None else m['instantiations'],
+                                            '-' if m['instantiation_ms'] is None else m['instantiation_ms']))
+        if baseline and tu in baseline:
+            b = baseline[tu]
+            print('%-32s %10s %12s %8s %10s' % ('  (baseline)', b.get('time_ms'), b.get('peak_rss_kb'),
+                                                '-' if b.get('instantiations') is None else b['instantiations'],
+                                                '-' if b.get('instantiation_ms') is None else b['instantiation_ms']))
+
+
+def main():
+    p = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    p.add_argument('command', choices=('record', 'check'))
+    p.add_argument('--compile-commands', required=True, help='path to compile_commands.json')
+    p.add_argument('--source-dir', required=True, help='only TUs under this directory are measured')
+    p.add_argument('--target', default='', help='only TUs of this CMake target are measured')
+    p.add_argument('--baseline', required=True, help='baseline file to write or compare against')
+    p.add_argument('--threshold', type=float, default=20.0, help='allowed growth, in percent')
+    p.add_argument('--slack-ms', type=float, default=50.0, help='extra allowance for the *_ms metrics')
+    p.add_argument('--repeat', type=int, default=3, help='compile each TU this many times')
+    p.add_argument('--fail', action='store_true',
+                   help='exit non-zero on instantiation or memory regressions, and unrecorded TUs')
+    opts = p.parse_args()
+    return record(opts) if opts.command == 'record' else check(opts)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
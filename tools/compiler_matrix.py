@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+#
+#  @copyright S. Levent Yilmaz 2016
+#  Distributed under the Boost Software License, Version 1.0.
+#  See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt.
+#
+"""Compile the static test suite with every installed compiler and language standard, in parallel.
+
+The compilers are the --compiler ones, or else every g++, g++-N, clang++ and clang++-N on PATH
+(one per real path). Each is probed for the --std standards it supports, trying the draft spelling
+(c++2a for c++20, ...) where the final one is not known. A cell of the matrix is a compiler and a
+standard; every test translation unit under --source-dir is compiled in every cell with
+-fsyntax-only, all of them spread over --jobs concurrent compiler processes.
+
+Include paths and definitions are taken from the --compile-commands of --target, if given, and from
+-I and -D. The table shows per cell the translation units that compiled, the sum of their compile
+times and the largest peak memory of the compiler. With --json the full results, per translation
+unit, are printed instead. The exit code is non-zero if any translation unit failed to compile.
+"""
+
+import argparse
+import concurrent.futures
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from compile_cost import load_commands, run_measured  # noqa: E402
+
+COMPILER_NAME = re.compile(r'^(g\+\+|clang\+\+)(-\d+(\.\d+)*)?$')
+STANDARDS = ['c++11', 'c++14', 'c++17', 'c++20', 'c++23']
+DRAFTS = {'c++14': 'c++1y', 'c++17': 'c++1z', 'c++20': 'c++2a', 'c++23': 'c++2b'}
+SOURCE_EXTS = ('.cpp', '.cxx', '.cc')
+
+
+#     +--------------+
+#     |  Toolchains  |
+#     +--------------+
+
+def installed_compilers():
+    """Every g++/clang++ on PATH, first one found per real path"""
+    found, seen = [], set()
+    for d in os.environ.get('PATH', '').split(os.pathsep):
+        try:
+            names = sorted(os.listdir(d))
+        except OSError:
+            continue
+        for name in names:
+            path = os.path.join(d, name)
+            if COMPILER_NAME.match(name) and os.access(path, os.X_OK):
+                real = os.path.realpath(path)
+                if real not in seen:
+                    seen.add(real)
+                    found.append(path)
+    return found
+
+
+def version(compiler):
+    out = subprocess.run([compiler, '--version'], stdout=subprocess.PIPE,
+                         stderr=subprocess.STDOUT, universal_newlines=True).stdout
+    return out.splitlines()[0].strip() if out else compiler
+
+
+def accepts(compiler, std):
+    return subprocess.run([compiler, '-std=' + std, '-fsyntax-only', '-x', 'c++', '-'],
+                          input='', stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL,
+                          universal_newlines=True).returncode == 0
+
+
+def spelling(compiler, std):
+    """The -std= spelling of the standard the compiler accepts, or None"""
+    for s in (std, DRAFTS.get(std)):
+        if s and accepts(compiler, s):
+            return s
+    return None
+
+
+#     +---------+
+#     |  Flags  |
+#     +---------+
+
+def flags_from(compile_commands, target, source_dir):
+    """Include and definition flags of the first compile command of the target"""
+    commands = load_commands(compile_commands, target, source_dir)
+    if not commands:
+        return []
+    _, cwd, args = commands[0]
+    flags, i = [], 0
+    while i < len(args):
+        a = args[i]
+        if a in ('-I', '-isystem', '-D') and i + 1 < len(args):
+            value = args[i + 1]
+            flags += [a, os.path.join(cwd, value) if a != '-D' else value]
+            i += 2
+            continue
+        if a.startswith('-I'):
+            flags.append('-I' + os.path.join(cwd, a[2:]))
+        elif a.startswith('-isystem'):
+            flags += ['-isystem', os.path.join(cwd, a[len('-isystem'):])]
+        elif a.startswith('-D'):
+            flags.append(a)
+        i += 1
+    return flags
+
+
+#     +----------+
+#     |  Matrix  |
+#     +----------+
+
+def compile_one(compiler, std, tu, flags, cwd):
+    cmd = [compiler, '-std=' + std, '-fsyntax-only'] + flags + [tu]
+    rc, err, ms, rss = run_measured(cmd, cwd)
+    return {'ok': rc == 0, 'time_ms': round(ms, 1), 'peak_rss_kb': rss,
+            'error': None if rc == 0 else err.strip().splitlines()[:20]}
+
+
+def run_matrix(compilers, standards, sources, flags, jobs):
+    cells = []
+    for c in compilers:
+        ver = version(c)
+        for std in standards:
+            cells.append({'compiler': c, 'version': ver, 'std': std,
+                          'flag': spelling(c, std), 'files': {}})
+
+    with tempfile.TemporaryDirectory() as tmp, \
+            concurrent.futures.ThreadPoolExecutor(max_workers=jobs) as pool:
+        futures = {}
+        for cell in cells:
+            if cell['flag'] is None:
+                continue
+            for tu in sources:
+                f = pool.submit(compile_one, cell['compiler'], cell['flag'], tu, flags, tmp)
+                futures[f] = (cell, tu)
+        for f in concurrent.futures.as_completed(futures):
+            cell, tu = futures[f]
+            cell['files'][tu] = f.result()
+    return cells
+
+
+def summary(cell):
+    files = cell['files'].values()
+    return {'passed': sum(1 for r in files if r['ok']), 'total': len(cell['files']),
+            'time_ms': round(sum(r['time_ms'] for r in files), 1),
+            'peak_rss_kb': max([r['peak_rss_kb'] for r in files] or [0])}
+
+
+def print_table(cells, standards):
+    rows = []
+    for cell in cells:
+        if not rows or rows[-1][0] != cell['compiler']:
+            rows.append((cell['compiler'], cell['version'], {}))
+        rows[-1][2][cell['std']] = cell
+
+    width = 24
+    head = '%-36s' % 'compiler' + ''.join('%-*s' % (width, s) for s in standards)
+    print(head)
+    print('-' * len(head))
+    for compiler, ver, by_std in rows:
+        line = '%-36s' % ver[:35]
+        for std in standards:
+            cell = by_std[std]
+            if cell['flag'] is None:
+                text = 'n/a'
+            else:
+                s = summary(cell)
+                text = '%s %d/%d %.1fs %dMB' % ('ok' if s['passed'] == s['total'] else 'FAIL',
+                                               s['passed'], s['total'], s['time_ms'] / 1000.0,
+                                               s['peak_rss_kb'] // 1024)
+            line += '%-*s' % (width, text)
+        print(line)
+
+    for cell in cells:
+        for tu, r in sorted(cell['files'].items()):
+            if not r['ok']:
+                print('\n%s -std=%s: %s failed:' % (cell['compiler'], cell['flag'], tu))
+                for l in r['error']:
+                    print('    ' + l)
+
+
+def main():
+    p = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    p.add_argument('--compiler', action='append', help='compilers to use (default: all on PATH)')
+    p.add_argument('--std', action='append', help='standards (default: c++11 through c++23)')
+    p.add_argument('--source-dir', required=True, help='compile the test TUs in this directory')
+    p.add_argument('--compile-commands', help='take include paths and definitions from here')
+    p.add_argument('--target', default='', help='... from the compile commands of this CMake target')
+    p.add_argument('--jobs', '-j', type=int, default=os.cpu_count() or 1)
+    p.add_argument('--json', action='store_true', help='print the results as JSON')
+    p.add_argument('-I', dest='includes', action='append', default=[])
+    p.add_argument('-D', dest='defines', action='append', default=[])
+    opts = p.parse_args()
+
+    compilers = opts.compiler or installed_compilers()
+    if not compilers:
+        raise SystemExit('compiler_matrix: no compilers found')
+    standards = opts.std or STANDARDS
+
+    source_dir = os.path.realpath(opts.source_dir)
+    sources = sorted(os.path.join(source_dir, f) for f in os.listdir(source_dir)
+                     if f.endswith(SOURCE_EXTS))
+    flags = []
+    if opts.compile_commands:
+        flags += flags_from(opts.compile_commands, opts.target, source_dir)
+    flags += ['-I' + os.path.abspath(i) for i in opts.includes]
+    flags += ['-D' + d for d in opts.defines]
+
+    cells = run_matrix(compilers, standards, sources, flags, opts.jobs)
+    if opts.json:
+        json.dump([dict(c, summary=summary(c)) for c in cells], sys.stdout, indent=2)
+        sys.stdout.write('\n')
+    else:
+        print_table(cells, standards)
+
+    failed = any(not r['ok'] for c in cells for r in c['files'].values())
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+#
+#  @copyright S. Levent Yilmaz 2016
+#  Distributed under the Boost Software License, Version 1.0.
+#  See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt.
+#
+"""Report which marked template specializations the static tests exercised.
+
+The ST_COVERAGE_POINT markers found in the --source files and directories are the specializations
+to cover. Built with ST_STATIC_EXPECT_CONFIG_COVERAGE=1, each instantiation of a marked
+specialization leaves a record in its object file:
+
+    [st-covered`<file>`<line>`<name>`]
+
+which are collected from the --objects files and directories (*.o, *.obj). A marker is exercised
+when some record carries its file and line; the file is compared by its real path, or by its name
+alone when the record's path can't be found from here.
+
+Prints the exercised and the unexercised markers, or with --json a JSON document of both. With
+--fail the exit code is non-zero if any marker is unexercised. With --expect, it is non-zero if the
+markers, or which of them are exercised, differ from those the given file lists, in the format of
+the report, each file by its name only:
+
+    exercised:
+      coverage_point.cpp:12: Rank<T*>
+    unexercised:
+      coverage_point.cpp:24: Rank<T&>
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+MARKER = 'ST_COVERAGE_POINT('
+RECORD = re.compile(rb'\[st-covered`([^`]*)`(\d+)`([^`]*)`\]')
+# Comments are blanked out before looking for markers; literals are matched so as to be left alone
+COMMENT_OR_LITERAL = re.compile(r'//[^\n]*|/\*.*?\*/|"(?:\\.|[^"\\\n])*"|\'(?:\\.|[^\'\\\n])*\'', re.S)
+SOURCE_EXTS = ('.hpp', '.h', '.hxx', '.ipp', '.cpp', '.cxx', '.cc')
+OBJECT_EXTS = ('.o', '.obj')
+# Lines of the report, as read back by --expect
+EXPECT_HEADING = re.compile(r'^(exercised|unexercised)(?: \(\d+\))?:$')
+EXPECT_POINT = re.compile(r'^(.+?):(\d+): (.+)$')
+
+
+def walk(paths, exts):
+    for p in paths:
+        if os.path.isfile(p):
+            yield p
+            continue
+        for root, _, files in os.walk(p):
+            for f in sorted(files):
+                if f.endswith(exts):
+                    yield os.path.join(root, f)
+
+
+def key(path, line):
+    return (os.path.basename(path), line)
+
+
+#     +-----------+
+#     |  Markers  |
+#     +-----------+
+
+def blank_comment(m):
+    s = m.group(0)
+    return '\n' * s.count('\n') if s.startswith('/') else s
+
+
+def markers(path):
+    """Generate (line, name) of every marker in the source file, skipping the macro definitions"""
+    with open(path, encoding='utf-8', errors='replace') as f:
+        src = COMMENT_OR_LITERAL.sub(blank_comment, f.read())
+    pos = src.find(MARKER)
+    while pos != -1:
+        line_start = src.rfind('\n', 0, pos) + 1
+        if not src[line_start:pos].lstrip().startswith('#'):
+            # the argument, up to the matching parenthesis
+            depth, i = 1, pos + len(MARKER)
+            while i < len(src) and depth:
+                depth += {'(': 1, ')': -1}.get(src[i], 0)
+                i += 1
+            name = ' '.join(src[pos + len(MARKER):i - 1].split())
+            if name and name != '...':
+                yield src.count('\n', 0, pos) + 1, name
+        pos = src.find(MARKER, pos + 1)
+
+
+def records(path):
+    """Set of (file, line) of the records in the object file"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    return {(m.group(1).decode('utf-8', 'replace'), int(m.group(2))) for m in RECORD.finditer(data)}
+
+
+#     +----------+
+#     |  Report  |
+#     +----------+
+
+def coverage(sources, objects):
+    hits, hit_names = {}, set()
+    for obj in walk(objects, OBJECT_EXTS):
+        for file, line in records(obj):
+            hits.setdefault(os.path.realpath(file), set()).add(line)
+            hit_names.add(key(file, line))
+
+    points = []
+    for src in walk(sources, SOURCE_EXTS):
+        for line, name in markers(src):
+            real = os.path.realpath(src)
+            exercised = line in hits.get(real, ()) or key(src, line) in hit_names
+            points.append({'file': src, 'line': line, 'name': name, 'exercised': exercised})
+    return points
+
+
+def expected(path):
+    """Dict of (file name, line, name) to whether the expectation file has it exercised"""
+    result, exercised = {}, None
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            m = EXPECT_HEADING.match(line)
+            if m:
+                exercised = m.group(1) == 'exercised'
+                continue
+            m = EXPECT_POINT.match(line)
+            if not m or exercised is None:
+                raise SystemExit('st_coverage: %s: not a marker of the report: %s' % (path, line))
+            result[(os.path.basename(m.group(1)), int(m.group(2)), m.group(3))] = exercised
+    return result
+
+
+def differences(points, expect):
+    """Lines telling how the points differ from the expectation"""
+    state = {True: 'exercised', False: 'unexercised'}
+    found = {(os.path.basename(x['file']), x['line'], x['name']): x['exercised'] for x in points}
+    lines = []
+    for k in sorted(set(found) | set(expect)):
+        where = '%s:%d: %s' % k
+        if k not in expect:
+            lines.append('  %s: %s, not expected' % (where, state[found[k]]))
+        elif k not in found:
+            lines.append('  %s: expected %s, no such marker' % (where, state[expect[k]]))
+        elif found[k] != expect[k]:
+            lines.append('  %s: %s, expected %s' % (where, state[found[k]], state[expect[k]]))
+    return lines
+
+
+def main():
+    p = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    p.add_argument('--source', action='append', required=True,
+                   help='source file or directory to find markers in (repeatable)')
+    p.add_argument('--objects', action='append', required=True,
+                   help='object file or directory to find records in (repeatable)')
+    p.add_argument('--json', action='store_true', help='print a JSON document')
+    p.add_argument('--fail', action='store_true', help='exit non-zero if a marker is unexercised')
+    p.add_argument('--expect', help='exit non-zero unless the report has the markers of this file')
+    opts = p.parse_args()
+
+    points = coverage(opts.source, opts.objects)
+    exercised = [x for x in points if x['exercised']]
+    unexercised = [x for x in points if not x['exercised']]
+
+    if opts.json:
+        json.dump({'summary': {'points': len(points), 'exercised': len(exercised),
+                               'unexercised': len(unexercised)},
+                   'points': points}, sys.stdout, indent=2)
+        sys.stdout.write('\n')
+    else:
+        for title, group in (('exercised', exercised), ('unexercised', unexercised)):
+            print('%s (%d):' % (title, len(group)))
+            for x in group:
+                print('  %s:%d: %s' % (x['file'], x['line'], x['name']))
+        print('coverage: %d of %d specializations' % (len(exercised), len(points)))
+
+    if opts.expect:
+        diff = differences(points, expected(opts.expect))
+        if diff:
+            sys.stderr.write('st_coverage: differs from %s:\n%s\n' % (opts.expect, '\n'.join(diff)))
+            return 1
+    return 1 if opts.fail and unexercised else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
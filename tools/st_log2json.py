@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+#
+#  @copyright S. Levent Yilmaz 2016
+#  Distributed under the Boost Software License, Version 1.0.
+#  See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt.
+#
+"""Extract static test failures from compiler output as JSON.
+
+Reads GCC, Clang or MSVC build output (files or stdin) in a single streaming pass and picks up the
+records that failing STATIC_EXPECT_* assertions embed in their static_assert message when built
+with ST_STATIC_EXPECT_CONFIG_STRUCTURED_MESSAGE=1:
+
+    [st-failure`<file>`<line>`<matcher>`0:<argument 0>`1:<argument 1>`...`]
+
+Lines without the record marker or a diagnostic heading are rejected with a couple of substring
+tests, so megabytes of template backtraces cost little more than reading them.
+
+An assertion in a template fails once per specialization, with the same record. Each is listed,
+with the specialization it failed in as `context`, taken from the `In instantiation of` heading
+before it (GCC) or the instantiation notes after it (Clang, MSVC); the same failure in the
+same context, reported more than once, is listed once. `reported_at` is where in the user's code
+the failure was triggered: the point of instantiation at the end of the `required from` chain, or
+the record's own file and line.
+
+Output is one JSON document with a summary and the list of failures, or with --jsonl one JSON
+object per failure, written as soon as the next one starts, or the output ends.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+MARKER = b'[st-failure`'
+RECORD = re.compile(rb'\[st-failure`([^`]*)`(\d+)`([^`]*)`((?:\d+:[^`]*`)*)\]')
+ARG = re.compile(rb'(\d+):([^`]*)`')
+
+# Errors:  GCC/Clang `file:line:col: error:`, MSVC `file(line): error`
+GNU_ERROR = re.compile(rb'^(.+?):(\d+):(?:\d+:)? (?:fatal )?error')
+MSVC_ERROR = re.compile(rb'^\s*(?:\d+>)?(.+?)\((\d+)(?:,\d+)?\)\s*: (?:fatal )?error')
+
+# GCC headings, before the errors they are about: the specialization being instantiated, the chain
+# of what required it, ending at the point of instantiation, and any other scope (which ends it)
+GCC_INSTANTIATION = re.compile(rb"^(?:.+?): In instantiation of '(.*)':\s*$")
+GCC_SUBSTITUTION = re.compile(rb"^(?:.+?): In substitution of '.*':\s*$")
+GCC_REQUIRED_HERE = re.compile(rb'^(.+?):(\d+):(?:\d+:)?\s+required from here')
+GCC_SCOPE = re.compile(rb'^(?:[^:\s][^:]*|.:[^:]*): (?:In|At) .*:\s*$')
+
+# Clang and MSVC notes, after the error: innermost specialization first, point of instantiation last
+CLANG_INSTANTIATION = re.compile(rb"^(.+?):(\d+):(?:\d+:)? note: in instantiation of .*?'(.*)' requested here")
+MSVC_INSTANTIATION = re.compile(rb"^\s*(?:\d+>)?(.+?)\((\d+)(?:,\d+)?\)\s*: note: see reference to "
+                                rb".*?instantiation '(.*)' being compiled")
+
+# The translation unit being built: CMake Makefiles, Ninja, MSBuild/cl
+TU_PATTERNS = [
+    re.compile(rb'Building CXX object (\S+)'),
+    re.compile(rb'^FAILED: (\S+)'),
+    re.compile(rb'^\s*(?:\d+>)?(\S+\.(?:cpp|cxx|cc|c\+\+))\s*$'),
+]
+
+
+def text(b):
+    return b.decode('utf-8', 'replace')
+
+
+def failures(stream):
+    """Generate a dict per distinct failure record found in the byte stream"""
+    seen = set()
+    tu = None
+    context, here = None, None      # GCC: the specialization being instantiated, and where
+    pending = None                  # the last failure, until what follows it is read
+    noted = False                   # Clang, MSVC: the notes of the pending failure are over
+    substitution = False            # GCC: the last heading was of a substitution
+
+    def first(f):
+        key = (f.pop('record'), f.pop('where'), f['context'])
+        if key in seen:
+            return False
+        seen.add(key)
+        return True
+
+    for line in stream:
+        if MARKER not in line:
+            if b'In ' in line or b'At ' in line or b'required from here' in line:
+                m = GCC_INSTANTIATION.match(line)
+                if m:
+                    context, here = text(m.group(1)), None
+                    continue
+                m = GCC_REQUIRED_HERE.match(line)
+                if m:
+                    here = '%s:%s' % (text(m.group(1)), text(m.group(2)))
+                    # The failure whose forged TypeN error this is was not in a specialization, but
+                    # right where it is written, whatever GCC's last heading was
+                    if pending and substitution and here == pending['where']:
+                        pending['context'], pending['reported_at'] = None, here
+                    continue
+                substitution = bool(GCC_SUBSTITUTION.match(line))
+                if GCC_SCOPE.match(line):
+                    context, here = None, None
+                    continue
+            if pending and not noted and b'instantiation' in line:
+                m = CLANG_INSTANTIATION.match(line) or MSVC_INSTANTIATION.match(line)
+                if m:
+                    if pending['context'] is None:
+                        pending['context'] = text(m.group(3))
+                    pending['reported_at'] = '%s:%s' % (text(m.group(1)), text(m.group(2)))
+                    continue
+            if pending and b'error' in line and (GNU_ERROR.match(line) or MSVC_ERROR.match(line)):
+                noted = True
+            if b'Building' in line or b'FAILED' in line or b'.c' in line:
+                for p in TU_PATTERNS:
+                    m = p.search(line)
+                    if m:
+                        tu = text(m.group(1))
+                        break
+            continue
+        m = RECORD.search(line)
+        if not m:
+            continue
+        if pending and first(pending):
+            yield pending
+
+        # Runtime reports (see runtime_expect.hpp) are no compiler errors, and have no heading
+        where = '%s:%s' % (text(m.group(1)), text(m.group(2)))
+        if not (GNU_ERROR.match(line) or MSVC_ERROR.match(line)):
+            context = None
+        pending = {
+            'file': text(m.group(1)),
+            'line': int(m.group(2)),
+            'matcher': text(m.group(3)),
+            'args': [{'index': int(i), 'expr': text(a)} for i, a in ARG.findall(m.group(4))],
+            'context': context,
+            'reported_at': here if context and here else where,
+            'tu': tu,
+            'message': text(line[m.end():].strip()),
+            'record': m.group(0),
+            'where': where,
+        }
+        noted, substitution = False, False
+    if pending and first(pending):
+        yield pending
+
+
+def main():
+    p = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    p.add_argument('logs', nargs='*', help='compiler output files (default: stdin)')
+    p.add_argument('--jsonl', action='store_true', help='one JSON object per line, as they complete')
+    p.add_argument('-o', '--output', help='write to this file instead of stdout')
+    opts = p.parse_args()
+
+    out = open(opts.output, 'w') if opts.output else sys.stdout
+    streams = [open(f, 'rb') for f in opts.logs] if opts.logs else [sys.stdin.buffer]
+    found = []
+    for s in streams:
+        for f in failures(s):
+            if opts.jsonl:
+                out.write(json.dumps(f) + '\n')
+                out.flush()
+            else:
+                found.append(f)
+        s.close()
+
+    if not opts.jsonl:
+        json.dump({'summary': {'failures': len(found),
+                               'files': len({f['file'] for f in found})},
+                   'failures': found}, out, indent=2)
+        out.write('\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())